@@ -3,13 +3,13 @@
 
 namespace abramov
 {
-  template < class Key, class Value, class Hash, class Equal >
+  template < class Key, class Value, class Hash, class Equal, class Alloc >
   struct HashTable;
 
-  template < class Key, class Value, class Hash, class Equal >
+  template < class Key, class Value, class Hash, class Equal, class Alloc >
   struct HashIterator;
 
-  template < class Key, class Value, class Hash, class Equal >
+  template < class Key, class Value, class Hash, class Equal, class Alloc >
   struct ConstHashIterator;
 }
 #endif
@@ -6,28 +6,28 @@
 
 namespace abramov
 {
-  template< class Key, class Value, class Hash, class Equal >
+  template< class Key, class Value, class Hash, class Equal, class Alloc >
   struct HashTable;
 
-  template< class Key, class Value, class Hash, class Equal >
+  template< class Key, class Value, class Hash, class Equal, class Alloc >
   struct ConstHashIterator: std::iterator< std::forward_iterator_tag, std::pair< Key, Value > >
   {
-    using cHash = const HashTable< Key, Value, Hash, Equal >;
-    using cIter = const ConstHashIterator< Key, Value, Hash, Equal >;
+    using cHash = const HashTable< Key, Value, Hash, Equal, Alloc >;
+    using cIter = const ConstHashIterator< Key, Value, Hash, Equal, Alloc >;
 
     ConstHashIterator();
-    ConstHashIterator(const HashTable< Key, Value, Hash, Equal > *t, size_t i, const HashNode< Key, Value > *n);
-    ConstHashIterator(const ConstHashIterator< Key, Value, Hash, Equal > &c_iter) = default;
+    ConstHashIterator(const HashTable< Key, Value, Hash, Equal, Alloc > *t, size_t i, const HashNode< Key, Value > *n);
+    ConstHashIterator(const ConstHashIterator< Key, Value, Hash, Equal, Alloc > &c_iter) = default;
     ~ConstHashIterator() = default;
-    ConstHashIterator< Key, Value, Hash, Equal > &operator=(const ConstHashIterator< Key, Value, Hash, Equal > &c_iter) = default;
-    ConstHashIterator< Key, Value, Hash, Equal > &operator++() noexcept;
-    ConstHashIterator< Key, Value, Hash, Equal > operator++(int) noexcept;
-    bool operator==(const ConstHashIterator< Key, Value, Hash, Equal > &c_iter) const noexcept;
-    bool operator!=(const ConstHashIterator< Key, Value, Hash, Equal > &c_iter) const noexcept;
+    ConstHashIterator< Key, Value, Hash, Equal, Alloc > &operator=(const ConstHashIterator< Key, Value, Hash, Equal, Alloc > &c_iter) = default;
+    ConstHashIterator< Key, Value, Hash, Equal, Alloc > &operator++() noexcept;
+    ConstHashIterator< Key, Value, Hash, Equal, Alloc > operator++(int) noexcept;
+    bool operator==(const ConstHashIterator< Key, Value, Hash, Equal, Alloc > &c_iter) const noexcept;
+    bool operator!=(const ConstHashIterator< Key, Value, Hash, Equal, Alloc > &c_iter) const noexcept;
     const std::pair< Key, Value > &operator*() const noexcept;
     const std::pair< Key, Value > *operator->() const noexcept;
   private:
-    const HashTable< Key, Value, Hash, Equal > *table_;
+    const HashTable< Key, Value, Hash, Equal, Alloc > *table_;
     size_t ind_;
     const HashNode< Key, Value > *node_;
 
@@ -35,22 +35,22 @@ namespace abramov
   };
 }
 
-template< class Key, class Value, class Hash, class Equal >
-abramov::ConstHashIterator< Key, Value, Hash, Equal >::ConstHashIterator():
+template< class Key, class Value, class Hash, class Equal, class Alloc >
+abramov::ConstHashIterator< Key, Value, Hash, Equal, Alloc >::ConstHashIterator():
   table_(nullptr),
   ind_(0),
   node_(nullptr)
 {}
 
-template< class Key, class Value, class Hash, class Equal >
-abramov::ConstHashIterator< Key, Value, Hash, Equal >::ConstHashIterator(cHash *t, size_t i, const HashNode< Key, Value > *n):
+template< class Key, class Value, class Hash, class Equal, class Alloc >
+abramov::ConstHashIterator< Key, Value, Hash, Equal, Alloc >::ConstHashIterator(cHash *t, size_t i, const HashNode< Key, Value > *n):
   table_(t),
   ind_(i),
   node_(n)
 {}
 
-template< class Key, class Value, class Hash, class Equal >
-abramov::ConstHashIterator< Key, Value, Hash, Equal > &abramov::ConstHashIterator< Key, Value, Hash, Equal >::operator++() noexcept
+template< class Key, class Value, class Hash, class Equal, class Alloc >
+abramov::ConstHashIterator< Key, Value, Hash, Equal, Alloc > &abramov::ConstHashIterator< Key, Value, Hash, Equal, Alloc >::operator++() noexcept
 {
   if (node_)
   {
@@ -63,8 +63,8 @@ abramov::ConstHashIterator< Key, Value, Hash, Equal > &abramov::ConstHashIterato
   return *this;
 }
 
-template< class Key, class Value, class Hash, class Equal >
-void abramov::ConstHashIterator< Key, Value, Hash, Equal >::goNext() noexcept
+template< class Key, class Value, class Hash, class Equal, class Alloc >
+void abramov::ConstHashIterator< Key, Value, Hash, Equal, Alloc >::goNext() noexcept
 {
   ++ind_;
   while (ind_ < table_->capacity_ && !table_->table_[ind_])
@@ -81,34 +81,34 @@ void abramov::ConstHashIterator< Key, Value, Hash, Equal >::goNext() noexcept
   }
 }
 
-template< class Key, class Value, class Hash, class Equal >
-abramov::ConstHashIterator< Key, Value, Hash, Equal > abramov::ConstHashIterator< Key, Value, Hash, Equal >::operator++(int) noexcept
+template< class Key, class Value, class Hash, class Equal, class Alloc >
+abramov::ConstHashIterator< Key, Value, Hash, Equal, Alloc > abramov::ConstHashIterator< Key, Value, Hash, Equal, Alloc >::operator++(int) noexcept
 {
-  ConstHashIterator< Key, Value, Hash, Equal > tmp(*this);
+  ConstHashIterator< Key, Value, Hash, Equal, Alloc > tmp(*this);
   ++(*this);
   return tmp;
 }
 
-template< class Key, class Value, class Hash, class Equal >
-bool abramov::ConstHashIterator< Key, Value, Hash, Equal >::operator==(cIter &rhs) const noexcept
+template< class Key, class Value, class Hash, class Equal, class Alloc >
+bool abramov::ConstHashIterator< Key, Value, Hash, Equal, Alloc >::operator==(cIter &rhs) const noexcept
 {
   return node_ == rhs.node_;
 }
 
-template< class Key, class Value, class Hash, class Equal >
-bool abramov::ConstHashIterator< Key, Value, Hash, Equal >::operator!=(cIter &rhs) const noexcept
+template< class Key, class Value, class Hash, class Equal, class Alloc >
+bool abramov::ConstHashIterator< Key, Value, Hash, Equal, Alloc >::operator!=(cIter &rhs) const noexcept
 {
   return !(*this == rhs);
 }
 
-template< class Key, class Value, class Hash, class Equal >
-const std::pair< Key, Value > &abramov::ConstHashIterator< Key, Value, Hash, Equal >::operator*() const noexcept
+template< class Key, class Value, class Hash, class Equal, class Alloc >
+const std::pair< Key, Value > &abramov::ConstHashIterator< Key, Value, Hash, Equal, Alloc >::operator*() const noexcept
 {
   return node_->data_;
 }
 
-template< class Key, class Value, class Hash, class Equal >
-const std::pair< Key, Value > *abramov::ConstHashIterator< Key, Value, Hash, Equal >::operator->() const noexcept
+template< class Key, class Value, class Hash, class Equal, class Alloc >
+const std::pair< Key, Value > *abramov::ConstHashIterator< Key, Value, Hash, Equal, Alloc >::operator->() const noexcept
 {
   return std::addressof(node_->data_);
 }
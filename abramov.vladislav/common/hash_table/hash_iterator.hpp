@@ -6,28 +6,28 @@
 
 namespace abramov
 {
-  template< class Key, class Value, class Hash, class Equal >
+  template< class Key, class Value, class Hash, class Equal, class Alloc >
   struct HashTable;
 
-  template< class Key, class Value, class Hash, class Equal >
+  template< class Key, class Value, class Hash, class Equal, class Alloc >
   struct HashIterator: std::iterator< std::forward_iterator_tag, std::pair< Key, Value > >
   {
-    using HashT = HashTable< Key, Value, Hash, Equal >;
-    using Iter = const HashIterator< Key, Value, Hash, Equal >;
+    using HashT = HashTable< Key, Value, Hash, Equal, Alloc >;
+    using Iter = const HashIterator< Key, Value, Hash, Equal, Alloc >;
 
     HashIterator();
-    HashIterator(HashTable< Key, Value, Hash, Equal > *t, size_t i, HashNode< Key, Value > *n);
-    HashIterator(const HashIterator< Key, Value, Hash, Equal > &iter) = default;
+    HashIterator(HashTable< Key, Value, Hash, Equal, Alloc > *t, size_t i, HashNode< Key, Value > *n);
+    HashIterator(const HashIterator< Key, Value, Hash, Equal, Alloc > &iter) = default;
     ~HashIterator() = default;
-    HashIterator< Key, Value, Hash, Equal > &operator=(const HashIterator< Key, Value, Hash, Equal > &iter) = default;
-    HashIterator< Key, Value, Hash, Equal > &operator++() noexcept;
-    HashIterator< Key, Value, Hash, Equal > operator++(int) noexcept;
-    bool operator==(const HashIterator< Key, Value, Hash, Equal > &iter) const noexcept;
-    bool operator!=(const HashIterator< Key, Value, Hash, Equal > &iter) const noexcept;
+    HashIterator< Key, Value, Hash, Equal, Alloc > &operator=(const HashIterator< Key, Value, Hash, Equal, Alloc > &iter) = default;
+    HashIterator< Key, Value, Hash, Equal, Alloc > &operator++() noexcept;
+    HashIterator< Key, Value, Hash, Equal, Alloc > operator++(int) noexcept;
+    bool operator==(const HashIterator< Key, Value, Hash, Equal, Alloc > &iter) const noexcept;
+    bool operator!=(const HashIterator< Key, Value, Hash, Equal, Alloc > &iter) const noexcept;
     std::pair< Key, Value > &operator*() noexcept;
     std::pair< Key, Value > *operator->() noexcept;
   private:
-    HashTable< Key, Value, Hash, Equal > *table_;
+    HashTable< Key, Value, Hash, Equal, Alloc > *table_;
     size_t ind_;
     HashNode< Key, Value > *node_;
 
@@ -35,22 +35,22 @@ namespace abramov
   };
 }
 
-template< class Key, class Value, class Hash, class Equal >
-abramov::HashIterator< Key, Value, Hash, Equal >::HashIterator():
+template< class Key, class Value, class Hash, class Equal, class Alloc >
+abramov::HashIterator< Key, Value, Hash, Equal, Alloc >::HashIterator():
   table_(nullptr),
   ind_(0),
   node_(nullptr)
 {}
 
-template< class Key, class Value, class Hash, class Equal >
-abramov::HashIterator< Key, Value, Hash, Equal >::HashIterator(HashT *t, size_t i, HashNode< Key, Value > *n):
+template< class Key, class Value, class Hash, class Equal, class Alloc >
+abramov::HashIterator< Key, Value, Hash, Equal, Alloc >::HashIterator(HashT *t, size_t i, HashNode< Key, Value > *n):
   table_(t),
   ind_(i),
   node_(n)
 {}
 
-template< class Key, class Value, class Hash, class Equal >
-abramov::HashIterator< Key, Value, Hash, Equal > &abramov::HashIterator< Key, Value, Hash, Equal >::operator++() noexcept
+template< class Key, class Value, class Hash, class Equal, class Alloc >
+abramov::HashIterator< Key, Value, Hash, Equal, Alloc > &abramov::HashIterator< Key, Value, Hash, Equal, Alloc >::operator++() noexcept
 {
   if (node_)
   {
@@ -63,8 +63,8 @@ abramov::HashIterator< Key, Value, Hash, Equal > &abramov::HashIterator< Key, Va
   return *this;
 }
 
-template< class Key, class Value, class Hash, class Equal >
-void abramov::HashIterator< Key, Value, Hash, Equal >::goNext() noexcept
+template< class Key, class Value, class Hash, class Equal, class Alloc >
+void abramov::HashIterator< Key, Value, Hash, Equal, Alloc >::goNext() noexcept
 {
   ++ind_;
   while (ind_ < table_->capacity_ && !table_->table_[ind_])
@@ -81,34 +81,34 @@ void abramov::HashIterator< Key, Value, Hash, Equal >::goNext() noexcept
   }
 }
 
-template< class Key, class Value, class Hash, class Equal >
-abramov::HashIterator< Key, Value, Hash, Equal > abramov::HashIterator< Key, Value, Hash, Equal >::operator++(int) noexcept
+template< class Key, class Value, class Hash, class Equal, class Alloc >
+abramov::HashIterator< Key, Value, Hash, Equal, Alloc > abramov::HashIterator< Key, Value, Hash, Equal, Alloc >::operator++(int) noexcept
 {
-  HashIterator< Key, Value, Hash, Equal > tmp(*this);
+  HashIterator< Key, Value, Hash, Equal, Alloc > tmp(*this);
   ++(*this);
   return tmp;
 }
 
-template< class Key, class Value, class Hash, class Equal >
-bool abramov::HashIterator< Key, Value, Hash, Equal >::operator==(Iter &rhs) const noexcept
+template< class Key, class Value, class Hash, class Equal, class Alloc >
+bool abramov::HashIterator< Key, Value, Hash, Equal, Alloc >::operator==(Iter &rhs) const noexcept
 {
   return node_ == rhs.node_;
 }
 
-template< class Key, class Value, class Hash, class Equal >
-bool abramov::HashIterator< Key, Value, Hash, Equal >::operator!=(Iter &rhs) const noexcept
+template< class Key, class Value, class Hash, class Equal, class Alloc >
+bool abramov::HashIterator< Key, Value, Hash, Equal, Alloc >::operator!=(Iter &rhs) const noexcept
 {
   return !(*this == rhs);
 }
 
-template< class Key, class Value, class Hash, class Equal >
-std::pair< Key, Value > &abramov::HashIterator< Key, Value, Hash, Equal >::operator*() noexcept
+template< class Key, class Value, class Hash, class Equal, class Alloc >
+std::pair< Key, Value > &abramov::HashIterator< Key, Value, Hash, Equal, Alloc >::operator*() noexcept
 {
   return node_->data_;
 }
 
-template< class Key, class Value, class Hash, class Equal >
-std::pair< Key, Value > *abramov::HashIterator< Key, Value, Hash, Equal >::operator->() noexcept
+template< class Key, class Value, class Hash, class Equal, class Alloc >
+std::pair< Key, Value > *abramov::HashIterator< Key, Value, Hash, Equal, Alloc >::operator->() noexcept
 {
   return std::addressof(node_->data_);
 }
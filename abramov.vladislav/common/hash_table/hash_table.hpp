@@ -2,39 +2,43 @@
 #define HASH_TABLE_HPP
 #include <cmath>
 #include <cstddef>
+#include <new>
 #include <algorithm>
 #include <functional>
 #include "decls.hpp"
 #include "hash_node.hpp"
+#include "node_pool.hpp"
 #include "hash_iterator.hpp"
 #include "hash_cIterator.hpp"
 
 namespace abramov
 {
-  template< class Key, class Value, class Hash = std::hash< Key >, class Equal = std::equal_to< Key > >
+  template< class Key, class Value, class Hash = std::hash< Key >, class Equal = std::equal_to< Key >,
+    class Alloc = NodePool< HashNode< Key, Value > > >
   struct HashTable
   {
-    using Iter = HashIterator< Key, Value, Hash, Equal >;
-    using cIter = ConstHashIterator< Key, Value, Hash, Equal >;
-    using Hash_t = HashTable< Key, Value, Hash, Equal >;
-    using cHash = const HashTable< Key, Value, Hash, Equal >;
+    using Iter = HashIterator< Key, Value, Hash, Equal, Alloc >;
+    using cIter = ConstHashIterator< Key, Value, Hash, Equal, Alloc >;
+    using Hash_t = HashTable< Key, Value, Hash, Equal, Alloc >;
+    using cHash = const HashTable< Key, Value, Hash, Equal, Alloc >;
 
     HashTable();
-    HashTable(const HashTable< Key, Value, Hash, Equal > &other);
+    HashTable(const HashTable< Key, Value, Hash, Equal, Alloc > &other);
     ~HashTable();
-    HashTable< Key, Value, Hash, Equal > &operator=(const HashTable< Key, Value, Hash, Equal > &other);
+    HashTable< Key, Value, Hash, Equal, Alloc > &operator=(const HashTable< Key, Value, Hash, Equal, Alloc > &other);
     void insert(const Key &k, const Value &v);
+    void clear() noexcept;
     double loadFactor() const noexcept;
     void rehash(size_t k);
     size_t erase(const Key &k);
     Value &at(const Key &k);
     Value &operator[](const Key &k);
-    HashIterator< Key, Value, Hash, Equal > begin();
-    HashIterator< Key, Value, Hash, Equal > end();
-    HashIterator< Key, Value, Hash, Equal > find(const Key &k);
-    ConstHashIterator< Key, Value, Hash, Equal > cbegin() const;
-    ConstHashIterator< Key, Value, Hash, Equal > cend() const;
-    ConstHashIterator< Key, Value, Hash, Equal > cfind(const Key &k) const;
+    HashIterator< Key, Value, Hash, Equal, Alloc > begin();
+    HashIterator< Key, Value, Hash, Equal, Alloc > end();
+    HashIterator< Key, Value, Hash, Equal, Alloc > find(const Key &k);
+    ConstHashIterator< Key, Value, Hash, Equal, Alloc > cbegin() const;
+    ConstHashIterator< Key, Value, Hash, Equal, Alloc > cend() const;
+    ConstHashIterator< Key, Value, Hash, Equal, Alloc > cfind(const Key &k) const;
     size_t size() const noexcept;
     bool empty() const noexcept;
 
@@ -44,31 +48,35 @@ namespace abramov
     size_t size_;
     Hash hash_;
     Equal equal_;
-    friend struct HashIterator< Key, Value, Hash, Equal >;
-    friend struct ConstHashIterator< Key, Value, Hash, Equal >;
+    Alloc alloc_;
+    friend struct HashIterator< Key, Value, Hash, Equal, Alloc >;
+    friend struct ConstHashIterator< Key, Value, Hash, Equal, Alloc >;
 
     void initTable();
+    HashNode< Key, Value > *createNode(const Key &k, const Value &v);
+    void destroyNodes() noexcept;
     void resizeIfNeed();
-    void swap(HashTable< Key, Value, Hash, Equal > &other) noexcept;
+    void swap(HashTable< Key, Value, Hash, Equal, Alloc > &other) noexcept;
     size_t findInsertPosition(const Key &k) const;
     bool isPrime(size_t k) const noexcept;
     size_t getLargerPrimeCapacity(size_t k) const noexcept;
   };
 }
 
-template< class Key, class Value, class Hash, class Equal >
-abramov::HashTable< Key, Value, Hash, Equal >::HashTable():
+template< class Key, class Value, class Hash, class Equal, class Alloc >
+abramov::HashTable< Key, Value, Hash, Equal, Alloc >::HashTable():
   table_(nullptr),
   capacity_(17),
   size_(0),
   hash_(std::hash< Key >()),
-  equal_(std::equal_to< Key >())
+  equal_(std::equal_to< Key >()),
+  alloc_()
 {
   initTable();
 }
 
-template< class Key, class Value, class Hash, class Equal >
-void abramov::HashTable< Key, Value, Hash, Equal >::initTable()
+template< class Key, class Value, class Hash, class Equal, class Alloc >
+void abramov::HashTable< Key, Value, Hash, Equal, Alloc >::initTable()
 {
   table_ = new HashNode< Key, Value >*[capacity_];
   for (size_t i = 0; i < capacity_; ++i)
@@ -77,50 +85,81 @@ void abramov::HashTable< Key, Value, Hash, Equal >::initTable()
   }
 }
 
-template< class Key, class Value, class Hash, class Equal >
-abramov::HashTable< Key, Value, Hash, Equal >::HashTable(cHash &other):
+template< class Key, class Value, class Hash, class Equal, class Alloc >
+abramov::HashTable< Key, Value, Hash, Equal, Alloc >::HashTable(cHash &other):
   table_(nullptr),
   capacity_(other.capacity_),
   size_(0),
   hash_(other.hash_),
-  equal_(other.equal_)
+  equal_(other.equal_),
+  alloc_()
 {
   initTable();
-  for (size_t i = 0; i < other.capacity_; ++i)
+  try
   {
-    HashNode< Key, Value > *curr = other.table_[i];
-    while (curr)
+    alloc_.reserve(other.size_);
+    for (size_t i = 0; i < other.capacity_; ++i)
     {
-      insert(curr->data_.first, curr->data_.second);
-      curr = curr->next_;
+      HashNode< Key, Value > **tail = std::addressof(table_[i]);
+      for (HashNode< Key, Value > *curr = other.table_[i]; curr; curr = curr->next_)
+      {
+        *tail = createNode(curr->data_.first, curr->data_.second);
+        tail = std::addressof((*tail)->next_);
+        ++size_;
+      }
     }
   }
+  catch (...)
+  {
+    destroyNodes();
+    delete[] table_;
+    throw;
+  }
 }
 
-template< class Key, class Value, class Hash, class Equal >
-void abramov::HashTable< Key, Value, Hash, Equal >::swap(Hash_t &other) noexcept
+template< class Key, class Value, class Hash, class Equal, class Alloc >
+void abramov::HashTable< Key, Value, Hash, Equal, Alloc >::swap(Hash_t &other) noexcept
 {
   std::swap(table_, other.table_);
   std::swap(capacity_, other.capacity_);
   std::swap(size_, other.size_);
   std::swap(hash_, other.hash_);
   std::swap(equal_, other.equal_);
+  alloc_.swap(other.alloc_);
 }
 
-template< class Key, class Value, class Hash, class Equal >
-typename abramov::HashTable< Key, Value, Hash, Equal >::Hash_t&
-abramov::HashTable< Key, Value, Hash, Equal >::operator=(cHash &other)
+template< class Key, class Value, class Hash, class Equal, class Alloc >
+typename abramov::HashTable< Key, Value, Hash, Equal, Alloc >::Hash_t&
+abramov::HashTable< Key, Value, Hash, Equal, Alloc >::operator=(cHash &other)
 {
   if (this != std::addressof(other))
   {
-    HashTable< Key, Value, Hash, Equal > temp(other);
+    HashTable< Key, Value, Hash, Equal, Alloc > temp(other);
     swap(temp);
   }
   return *this;
 }
 
-template< class Key, class Value, class Hash, class Equal >
-abramov::HashTable< Key, Value, Hash, Equal >::~HashTable()
+template< class Key, class Value, class Hash, class Equal, class Alloc >
+abramov::HashTable< Key, Value, Hash, Equal, Alloc >::~HashTable()
+{
+  destroyNodes();
+  delete[] table_;
+}
+
+template< class Key, class Value, class Hash, class Equal, class Alloc >
+void abramov::HashTable< Key, Value, Hash, Equal, Alloc >::clear() noexcept
+{
+  destroyNodes();
+  for (size_t i = 0; i < capacity_; ++i)
+  {
+    table_[i] = nullptr;
+  }
+  size_ = 0;
+}
+
+template< class Key, class Value, class Hash, class Equal, class Alloc >
+void abramov::HashTable< Key, Value, Hash, Equal, Alloc >::destroyNodes() noexcept
 {
   for (size_t i = 0; i < capacity_; ++i)
   {
@@ -128,33 +167,41 @@ abramov::HashTable< Key, Value, Hash, Equal >::~HashTable()
     while (curr)
     {
       HashNode< Key, Value > *next = curr->next_;
-      delete curr;
+      curr->~HashNode();
       curr = next;
     }
   }
-  delete[] table_;
+  alloc_.release();
 }
 
-template< class Key, class Value, class Hash, class Equal >
-void abramov::HashTable< Key, Value, Hash, Equal >::insert(const Key &k, const Value &v)
+template< class Key, class Value, class Hash, class Equal, class Alloc >
+abramov::HashNode< Key, Value > *abramov::HashTable< Key, Value, Hash, Equal, Alloc >::createNode(const Key &k, const Value &v)
 {
-  resizeIfNeed();
-  size_t pos = findInsertPosition(k);
-  if (!table_[pos])
+  HashNode< Key, Value > *node = alloc_.allocate();
+  try
   {
-    table_[pos] = new HashNode< Key, Value >(k, v);
+    return new (node) HashNode< Key, Value >(k, v);
   }
-  else
+  catch (...)
   {
-    HashNode< Key, Value > *new_node = new HashNode< Key, Value >(k, v);
-    new_node->next_ = table_[pos];
-    table_[pos] = new_node;
+    alloc_.deallocate(node);
+    throw;
   }
+}
+
+template< class Key, class Value, class Hash, class Equal, class Alloc >
+void abramov::HashTable< Key, Value, Hash, Equal, Alloc >::insert(const Key &k, const Value &v)
+{
+  resizeIfNeed();
+  size_t pos = findInsertPosition(k);
+  HashNode< Key, Value > *new_node = createNode(k, v);
+  new_node->next_ = table_[pos];
+  table_[pos] = new_node;
   ++size_;
 }
 
-template< class Key, class Value, class Hash, class Equal >
-void abramov::HashTable< Key, Value, Hash, Equal >::resizeIfNeed()
+template< class Key, class Value, class Hash, class Equal, class Alloc >
+void abramov::HashTable< Key, Value, Hash, Equal, Alloc >::resizeIfNeed()
 {
   constexpr double max = 0.8;
   if (loadFactor() > max)
@@ -163,14 +210,14 @@ void abramov::HashTable< Key, Value, Hash, Equal >::resizeIfNeed()
   }
 }
 
-template< class Key, class Value, class Hash, class Equal >
-double abramov::HashTable< Key, Value, Hash, Equal >::loadFactor() const noexcept
+template< class Key, class Value, class Hash, class Equal, class Alloc >
+double abramov::HashTable< Key, Value, Hash, Equal, Alloc >::loadFactor() const noexcept
 {
   return static_cast< double >(size_) / capacity_;
 }
 
-template< class Key, class Value, class Hash, class Equal >
-void abramov::HashTable< Key, Value, Hash, Equal >::rehash(size_t k)
+template< class Key, class Value, class Hash, class Equal, class Alloc >
+void abramov::HashTable< Key, Value, Hash, Equal, Alloc >::rehash(size_t k)
 {
   HashNode< Key, Value > **old_table = table_;
   size_t old_capacity = capacity_;
@@ -182,17 +229,19 @@ void abramov::HashTable< Key, Value, Hash, Equal >::rehash(size_t k)
     HashNode< Key, Value > *curr = old_table[i];
     while (curr)
     {
-      insert(curr->data_.first, curr->data_.second);
       HashNode< Key, Value > *next = curr->next_;
-      delete curr;
+      size_t pos = findInsertPosition(curr->data_.first);
+      curr->next_ = table_[pos];
+      table_[pos] = curr;
+      ++size_;
       curr = next;
     }
   }
   delete[] old_table;
 }
 
-template< class Key, class Value, class Hash, class Equal >
-size_t abramov::HashTable< Key, Value, Hash, Equal >::findInsertPosition(const Key &k) const
+template< class Key, class Value, class Hash, class Equal, class Alloc >
+size_t abramov::HashTable< Key, Value, Hash, Equal, Alloc >::findInsertPosition(const Key &k) const
 {
   size_t pos = hash_(k) % capacity_;
   size_t att = 0;
@@ -204,8 +253,8 @@ size_t abramov::HashTable< Key, Value, Hash, Equal >::findInsertPosition(const K
   return pos;
 }
 
-template< class Key, class Value, class Hash, class Equal >
-size_t abramov::HashTable< Key, Value, Hash, Equal >::erase(const Key &k)
+template< class Key, class Value, class Hash, class Equal, class Alloc >
+size_t abramov::HashTable< Key, Value, Hash, Equal, Alloc >::erase(const Key &k)
 {
   size_t removed = 0;
   size_t orig_pos = hash_(k) % capacity_;
@@ -229,7 +278,8 @@ size_t abramov::HashTable< Key, Value, Hash, Equal >::erase(const Key &k)
           table_[pos] = curr->next_;
         }
         curr = curr->next_;
-        delete del;
+        del->~HashNode();
+        alloc_.deallocate(del);
         ++removed;
         --size_;
       }
@@ -245,8 +295,8 @@ size_t abramov::HashTable< Key, Value, Hash, Equal >::erase(const Key &k)
   return removed;
 }
 
-template< class Key, class Value, class Hash, class Equal >
-Value &abramov::HashTable< Key, Value, Hash, Equal >::operator[](const Key &k)
+template< class Key, class Value, class Hash, class Equal, class Alloc >
+Value &abramov::HashTable< Key, Value, Hash, Equal, Alloc >::operator[](const Key &k)
 {
   auto it = find(k);
   if (it != end())
@@ -257,30 +307,30 @@ Value &abramov::HashTable< Key, Value, Hash, Equal >::operator[](const Key &k)
   return find(k)->second;
 }
 
-template< class Key, class Value, class Hash, class Equal >
-typename abramov::HashTable< Key, Value, Hash, Equal >::Iter
-abramov::HashTable< Key, Value, Hash, Equal >::end()
+template< class Key, class Value, class Hash, class Equal, class Alloc >
+typename abramov::HashTable< Key, Value, Hash, Equal, Alloc >::Iter
+abramov::HashTable< Key, Value, Hash, Equal, Alloc >::end()
 {
-  return HashIterator< Key, Value, Hash, Equal >(this, capacity_, nullptr);
+  return HashIterator< Key, Value, Hash, Equal, Alloc >(this, capacity_, nullptr);
 }
 
-template< class Key, class Value, class Hash, class Equal >
-typename abramov::HashTable< Key, Value, Hash, Equal >::Iter
-abramov::HashTable< Key, Value, Hash, Equal >::begin()
+template< class Key, class Value, class Hash, class Equal, class Alloc >
+typename abramov::HashTable< Key, Value, Hash, Equal, Alloc >::Iter
+abramov::HashTable< Key, Value, Hash, Equal, Alloc >::begin()
 {
   for (size_t i = 0; i < capacity_; ++i)
   {
     if (table_[i])
     {
-      return HashIterator< Key, Value, Hash, Equal >(this, i, table_[i]);
+      return HashIterator< Key, Value, Hash, Equal, Alloc >(this, i, table_[i]);
     }
   }
   return end();
 }
 
-template< class Key, class Value, class Hash, class Equal >
-typename abramov::HashTable< Key, Value, Hash, Equal >::Iter
-abramov::HashTable< Key, Value, Hash, Equal >::find(const Key & k)
+template< class Key, class Value, class Hash, class Equal, class Alloc >
+typename abramov::HashTable< Key, Value, Hash, Equal, Alloc >::Iter
+abramov::HashTable< Key, Value, Hash, Equal, Alloc >::find(const Key & k)
 {
   if (empty())
   {
@@ -296,7 +346,7 @@ abramov::HashTable< Key, Value, Hash, Equal >::find(const Key & k)
     {
       if (equal_(curr->data_.first, k))
       {
-        return HashIterator< Key, Value, Hash, Equal >(this, pos, curr);
+        return HashIterator< Key, Value, Hash, Equal, Alloc >(this, pos, curr);
       }
       curr = curr->next_;
     }
@@ -306,30 +356,30 @@ abramov::HashTable< Key, Value, Hash, Equal >::find(const Key & k)
   return end();
 }
 
-template< class Key, class Value, class Hash, class Equal >
-typename abramov::HashTable< Key, Value, Hash, Equal >::cIter
-abramov::HashTable< Key, Value, Hash, Equal >::cend() const
+template< class Key, class Value, class Hash, class Equal, class Alloc >
+typename abramov::HashTable< Key, Value, Hash, Equal, Alloc >::cIter
+abramov::HashTable< Key, Value, Hash, Equal, Alloc >::cend() const
 {
-  return ConstHashIterator< Key, Value, Hash, Equal >(this, capacity_, nullptr);
+  return ConstHashIterator< Key, Value, Hash, Equal, Alloc >(this, capacity_, nullptr);
 }
 
-template< class Key, class Value, class Hash, class Equal >
-typename abramov::HashTable< Key, Value, Hash, Equal >::cIter
-abramov::HashTable< Key, Value, Hash, Equal >::cbegin() const
+template< class Key, class Value, class Hash, class Equal, class Alloc >
+typename abramov::HashTable< Key, Value, Hash, Equal, Alloc >::cIter
+abramov::HashTable< Key, Value, Hash, Equal, Alloc >::cbegin() const
 {
   for (size_t i = 0; i < capacity_; ++i)
   {
     if (table_[i])
     {
-      return ConstHashIterator< Key, Value, Hash, Equal >(this, i, table_[i]);
+      return ConstHashIterator< Key, Value, Hash, Equal, Alloc >(this, i, table_[i]);
     }
   }
   return cend();
 }
 
-template< class Key, class Value, class Hash, class Equal >
-typename abramov::HashTable< Key, Value, Hash, Equal >::cIter
-abramov::HashTable< Key, Value, Hash, Equal >::cfind(const Key & k) const
+template< class Key, class Value, class Hash, class Equal, class Alloc >
+typename abramov::HashTable< Key, Value, Hash, Equal, Alloc >::cIter
+abramov::HashTable< Key, Value, Hash, Equal, Alloc >::cfind(const Key & k) const
 {
   if (empty())
   {
@@ -345,7 +395,7 @@ abramov::HashTable< Key, Value, Hash, Equal >::cfind(const Key & k) const
     {
       if (equal_(curr->data_.first, k))
       {
-        return ConstHashIterator< Key, Value, Hash, Equal >(this, pos, curr);
+        return ConstHashIterator< Key, Value, Hash, Equal, Alloc >(this, pos, curr);
       }
       curr = curr->next_;
     }
@@ -355,8 +405,8 @@ abramov::HashTable< Key, Value, Hash, Equal >::cfind(const Key & k) const
   return cend();
 }
 
-template< class Key, class Value, class Hash, class Equal >
-Value &abramov::HashTable< Key, Value, Hash, Equal >::at(const Key &k)
+template< class Key, class Value, class Hash, class Equal, class Alloc >
+Value &abramov::HashTable< Key, Value, Hash, Equal, Alloc >::at(const Key &k)
 {
   auto it = find(k);
   if (it == end())
@@ -367,20 +417,20 @@ Value &abramov::HashTable< Key, Value, Hash, Equal >::at(const Key &k)
 }
 
 
-template< class Key, class Value, class Hash, class Equal >
-size_t abramov::HashTable< Key, Value, Hash, Equal >::size() const noexcept
+template< class Key, class Value, class Hash, class Equal, class Alloc >
+size_t abramov::HashTable< Key, Value, Hash, Equal, Alloc >::size() const noexcept
 {
   return size_;
 }
 
-template< class Key, class Value, class Hash, class Equal >
-bool abramov::HashTable< Key, Value, Hash, Equal >::empty() const noexcept
+template< class Key, class Value, class Hash, class Equal, class Alloc >
+bool abramov::HashTable< Key, Value, Hash, Equal, Alloc >::empty() const noexcept
 {
   return size_ == 0;
 }
 
-template< class Key, class Value, class Hash, class Equal >
-bool abramov::HashTable< Key, Value, Hash, Equal >::isPrime(size_t k) const noexcept
+template< class Key, class Value, class Hash, class Equal, class Alloc >
+bool abramov::HashTable< Key, Value, Hash, Equal, Alloc >::isPrime(size_t k) const noexcept
 {
   if (k % 2 == 0)
   {
@@ -396,8 +446,8 @@ bool abramov::HashTable< Key, Value, Hash, Equal >::isPrime(size_t k) const noex
   return true;
 }
 
-template< class Key, class Value, class Hash, class Equal >
-size_t abramov::HashTable< Key, Value, Hash, Equal >::getLargerPrimeCapacity(size_t k) const noexcept
+template< class Key, class Value, class Hash, class Equal, class Alloc >
+size_t abramov::HashTable< Key, Value, Hash, Equal, Alloc >::getLargerPrimeCapacity(size_t k) const noexcept
 {
   size_t cand = 2 * cand + 1;
   while (true)
@@ -0,0 +1,135 @@
+#ifndef NODE_POOL_HPP
+#define NODE_POOL_HPP
+#include <cstddef>
+#include <utility>
+#include <algorithm>
+
+namespace abramov
+{
+  template< class T >
+  struct NodePool
+  {
+    NodePool() noexcept;
+    NodePool(const NodePool< T > &other) = delete;
+    ~NodePool();
+    NodePool< T > &operator=(const NodePool< T > &other) = delete;
+    T *allocate();
+    void deallocate(T *node) noexcept;
+    void reserve(size_t k);
+    void release() noexcept;
+    void swap(NodePool< T > &other) noexcept;
+
+  private:
+    union Cell
+    {
+      Cell *next_;
+      alignas(T) unsigned char data_[sizeof(T)];
+    };
+
+    static constexpr size_t min_slab_ = 32;
+    static constexpr size_t max_slab_ = 4096;
+
+    Cell *slabs_;
+    Cell *free_;
+    Cell *cursor_;
+    Cell *end_;
+    size_t next_slab_;
+
+    void addSlab(size_t k);
+  };
+}
+
+template< class T >
+constexpr size_t abramov::NodePool< T >::min_slab_;
+
+template< class T >
+constexpr size_t abramov::NodePool< T >::max_slab_;
+
+template< class T >
+abramov::NodePool< T >::NodePool() noexcept:
+  slabs_(nullptr),
+  free_(nullptr),
+  cursor_(nullptr),
+  end_(nullptr),
+  next_slab_(min_slab_)
+{}
+
+template< class T >
+abramov::NodePool< T >::~NodePool()
+{
+  release();
+}
+
+template< class T >
+T *abramov::NodePool< T >::allocate()
+{
+  if (free_)
+  {
+    Cell *cell = free_;
+    free_ = cell->next_;
+    return reinterpret_cast< T* >(cell->data_);
+  }
+  if (cursor_ == end_)
+  {
+    addSlab(next_slab_);
+    next_slab_ = std::min(next_slab_ * 2, max_slab_);
+  }
+  return reinterpret_cast< T* >((cursor_++)->data_);
+}
+
+template< class T >
+void abramov::NodePool< T >::deallocate(T *node) noexcept
+{
+  Cell *cell = reinterpret_cast< Cell* >(node);
+  cell->next_ = free_;
+  free_ = cell;
+}
+
+template< class T >
+void abramov::NodePool< T >::reserve(size_t k)
+{
+  if (static_cast< size_t >(end_ - cursor_) < k)
+  {
+    addSlab(k);
+  }
+}
+
+template< class T >
+void abramov::NodePool< T >::release() noexcept
+{
+  while (slabs_)
+  {
+    Cell *next = slabs_->next_;
+    delete[] slabs_;
+    slabs_ = next;
+  }
+  free_ = nullptr;
+  cursor_ = nullptr;
+  end_ = nullptr;
+  next_slab_ = min_slab_;
+}
+
+template< class T >
+void abramov::NodePool< T >::swap(NodePool< T > &other) noexcept
+{
+  std::swap(slabs_, other.slabs_);
+  std::swap(free_, other.free_);
+  std::swap(cursor_, other.cursor_);
+  std::swap(end_, other.end_);
+  std::swap(next_slab_, other.next_slab_);
+}
+
+template< class T >
+void abramov::NodePool< T >::addSlab(size_t k)
+{
+  Cell *slab = new Cell[k + 1];
+  slab->next_ = slabs_;
+  slabs_ = slab;
+  while (cursor_ != end_)
+  {
+    deallocate(reinterpret_cast< T* >((cursor_++)->data_));
+  }
+  cursor_ = slab + 1;
+  end_ = slab + k + 1;
+}
+#endif
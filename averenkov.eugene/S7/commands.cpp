@@ -17,6 +17,21 @@ namespace
       vertices.push_back(vertex);
     }
   }
+
+  void printAdjacent(std::ostream& out, const averenkov::CsrGraph& graph, size_t first, size_t last,
+    const averenkov::Array< size_t >& neighbors, const averenkov::Array< size_t >& weights)
+  {
+    while (first != last)
+    {
+      size_t neighbor = neighbors[first];
+      out << graph.names[neighbor];
+      for (; first != last && neighbors[first] == neighbor; ++first)
+      {
+        out << " " << weights[first];
+      }
+      out << "\n";
+    }
+  }
 }
 
 void averenkov::loadGraphsFromFile(Tree< std::string, Graph >& graphs, std::istream& in)
@@ -78,34 +93,15 @@ void averenkov::printVertices(std::ostream& out, std::istream& in, const Tree< s
   {
     throw std::invalid_argument("Invalid command");
   }
-  Array< std::string > vertexNames;
-  for (auto vit = it->second.vertices.begin(); vit != it->second.vertices.end(); ++vit)
-  {
-    vertexNames.push_back(vit->key);
-  }
-  for (size_t i = 0; i < vertexNames.size(); ++i)
-  {
-    size_t minIndex = i;
-    for (size_t j = i + 1; j < vertexNames.size(); ++j)
-    {
-      if (vertexNames[j] < vertexNames[minIndex])
-      {
-        minIndex = j;
-      }
-    }
-    if (minIndex != i)
-    {
-      std::swap(vertexNames[i], vertexNames[minIndex]);
-    }
-  }
-  if (vertexNames.empty())
+  const CsrGraph& graph = it->second.snapshot();
+  if (graph.names.empty())
   {
     out << "\n";
     return;
   }
-  for (size_t i = 0; i < vertexNames.size(); ++i)
+  for (size_t i = 0; i < graph.names.size(); ++i)
   {
-    out << vertexNames[i] << "\n";
+    out << graph.names[i] << "\n";
   }
 }
 
@@ -115,59 +111,22 @@ void averenkov::printOutbound(std::ostream& out, std::istream& in, const Tree< s
   std::string vertex;
   in >> graphName >> vertex;
   auto it = graphs.find(graphName);
-  if (it == graphs.end() || it->second.vertices.find(vertex) == it->second.vertices.end())
+  if (it == graphs.end())
   {
     throw std::invalid_argument("Invalid command");
   }
-  auto edgesIt = it->second.edges.find(vertex);
-  if (edgesIt == it->second.edges.end())
+  const CsrGraph& graph = it->second.snapshot();
+  size_t id = graph.findVertex(vertex);
+  if (id == graph.names.size())
   {
-    out << "\n";
-    return;
-  }
-  Array< std::string > targets;
-  Tree< std::string, Array< size_t > > weightsMap;
-  for (auto it = edgesIt->value.begin(); it != edgesIt->value.end(); ++it)
-  {
-    targets.push_back(it->key);
-    weightsMap.insert({it->key, it->value});
-  }
-  for (size_t i = 0; i < targets.size(); ++i)
-  {
-    for (size_t j = i + 1; j < targets.size(); ++j)
-    {
-      if (targets[j] < targets[i])
-      {
-        std::swap(targets[i], targets[j]);
-      }
-    }
+    throw std::invalid_argument("Invalid command");
   }
-  if (targets.empty())
+  if (graph.outOffsets[id] == graph.outOffsets[id + 1])
   {
     out << "\n";
     return;
   }
-  for (size_t i = 0; i < targets.size(); ++i)
-  {
-    auto weightsIt = weightsMap.find(targets[i]);
-    out << targets[i];
-    Array< size_t > weights = weightsIt->second;
-    for (size_t j = 0; j < weights.size(); ++j)
-    {
-      for (size_t k = j + 1; k < weights.size(); ++k)
-      {
-        if (weights[k] < weights[j])
-        {
-          std::swap(weights[j], weights[k]);
-        }
-      }
-    }
-    for (size_t j = 0; j < weights.size(); ++j)
-    {
-      out << " " << weights[j];
-    }
-    out << "\n";
-  }
+  printAdjacent(out, graph, graph.outOffsets[id], graph.outOffsets[id + 1], graph.outTargets, graph.outWeights);
 }
 
 void averenkov::printInbound(std::ostream& out, std::istream& in, const Tree< std::string, Graph >& graphs)
@@ -179,55 +138,13 @@ void averenkov::printInbound(std::ostream& out, std::istream& in, const Tree< st
   {
     throw std::invalid_argument("Graph not found");
   }
-  if (graphIt->second.vertices.find(vertex) == graphIt->second.vertices.end())
+  const CsrGraph& graph = graphIt->second.snapshot();
+  size_t id = graph.findVertex(vertex);
+  if (id == graph.names.size())
   {
     throw std::invalid_argument("Invalid command");
   }
-  Array< std::string > sources;
-  Tree< std::string, Array< size_t > > weightsMap;
-  for (auto fromIt = graphIt->second.edges.begin(); fromIt != graphIt->second.edges.end(); ++fromIt)
-  {
-    for (auto toIt = fromIt->value.begin(); toIt != fromIt->value.end(); ++toIt)
-    {
-      if (toIt->key == vertex)
-      {
-        sources.push_back(fromIt->key);
-        weightsMap.insert({fromIt->key, toIt->value});
-        break;
-      }
-    }
-  }
-  for (size_t i = 0; i < sources.size(); ++i)
-  {
-    for (size_t j = i + 1; j < sources.size(); ++j)
-    {
-      if (sources[j] < sources[i])
-      {
-        std::swap(sources[i], sources[j]);
-      }
-    }
-  }
-  for (size_t i = 0; i < sources.size(); ++i)
-  {
-    auto weightsIt = weightsMap.find(sources[i]);
-    Array< size_t > weights = weightsIt->second;
-    for (size_t j = 0; j < weights.size(); ++j)
-    {
-      for (size_t k = j + 1; k < weights.size(); ++k)
-      {
-        if (weights[k] < weights[j])
-        {
-          std::swap(weights[j], weights[k]);
-        }
-      }
-    }
-    out << sources[i];
-    for (size_t j = 0; j < weights.size(); ++j)
-    {
-      out << " " << weights[j];
-    }
-    out << "\n";
-  }
+  printAdjacent(out, graph, graph.inOffsets[id], graph.inOffsets[id + 1], graph.inSources, graph.inWeights);
 }
 
 void averenkov::bindEdge(std::istream& in, Tree< std::string, Graph >& graphs)
@@ -256,38 +173,10 @@ void averenkov::cutEdge(std::istream& in, Tree< std::string, Graph >& graphs)
   {
     throw std::invalid_argument("Graph not found");
   }
-  auto fromIt = graphIt->second.edges.find(from);
-  if (fromIt == graphIt->second.edges.end())
+  if (!graphIt->second.removeEdge(from, to, weight))
   {
     throw std::invalid_argument("Edge not found");
   }
-  auto toIt = fromIt->value.find(to);
-  if (toIt == fromIt->value.end())
-  {
-    throw std::invalid_argument("Edge not found");
-  }
-  bool found = false;
-  for (size_t i = 0; i < toIt->value.size(); ++i)
-  {
-    if (toIt->value[i] == weight)
-    {
-      for (size_t j = i; j < toIt->value.size() - 1; ++j)
-      {
-        toIt->value[j] = toIt->value[j + 1];
-      }
-      toIt->value.pop_back();
-      found = true;
-      break;
-    }
-  }
-  if (!found)
-  {
-    throw std::invalid_argument("Weight not found");
-  }
-  if (toIt->value.empty())
-  {
-    fromIt->value.erase(to);
-  }
 }
 
 void averenkov::createGraph(std::istream& in, Tree< std::string, Graph >& graphs)
@@ -346,7 +235,7 @@ void averenkov::mergeGraphs(std::istream& in, Tree< std::string, Graph >& graphs
       {
         HashTable< std::string, Array< size_t > > newMap;
         newMap.insert({toIt->key, toIt->value});
-        mergedGraph.edges.insert({fromIt->key, newMap});
+        mergedGraph.edges.emplace(fromIt->key, std::move(newMap));
       }
       else
       {
@@ -363,7 +252,7 @@ void averenkov::mergeGraphs(std::istream& in, Tree< std::string, Graph >& graphs
       {
         HashTable< std::string, Array< size_t > > newMap;
         newMap.insert({toIt->key, toIt->value});
-        mergedGraph.edges.insert({fromIt->key, newMap});
+        mergedGraph.edges.emplace(fromIt->key, std::move(newMap));
       }
       else
       {
@@ -437,7 +326,7 @@ void averenkov::extractGraph(std::istream& in, Tree< std::string, Graph >& graph
           {
             HashTable< std::string, Array< size_t > > newMap;
             newMap.insert({toIt->key, toIt->value});
-            extractedGraph.edges.insert({vertices[i], newMap});
+            extractedGraph.edges.emplace(vertices[i], std::move(newMap));
           }
           else
           {
@@ -5,6 +5,7 @@
 #include <string>
 #include <BiTree.hpp>
 #include <graph.hpp>
+#include <csrGraph.hpp>
 
 namespace averenkov
 {
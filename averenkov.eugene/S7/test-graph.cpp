@@ -0,0 +1,57 @@
+#include <boost/test/unit_test.hpp>
+#include <graph.hpp>
+#include <csrGraph.hpp>
+
+using namespace averenkov;
+
+BOOST_AUTO_TEST_SUITE(CsrGraphTests)
+
+BOOST_AUTO_TEST_CASE(SortedRows)
+{
+  Graph graph;
+  graph.addEdge("b", "c", 4);
+  graph.addEdge("b", "a", 2);
+  graph.addEdge("b", "c", 1);
+  graph.addEdge("a", "b", 3);
+  graph.addVertex("d");
+
+  const CsrGraph& csr = graph.snapshot();
+  BOOST_TEST(csr.names.size() == 4);
+  BOOST_TEST(csr.names[0] == "a");
+  BOOST_TEST(csr.names[3] == "d");
+
+  size_t b = csr.findVertex("b");
+  BOOST_TEST(b == 1);
+  BOOST_TEST(csr.outOffsets[b + 1] - csr.outOffsets[b] == 3);
+  BOOST_TEST(csr.outTargets[csr.outOffsets[b]] == csr.findVertex("a"));
+  BOOST_TEST(csr.outWeights[csr.outOffsets[b] + 1] == 1);
+  BOOST_TEST(csr.outWeights[csr.outOffsets[b] + 2] == 4);
+
+  size_t c = csr.findVertex("c");
+  BOOST_TEST(csr.inOffsets[c + 1] - csr.inOffsets[c] == 2);
+  BOOST_TEST(csr.inSources[csr.inOffsets[c]] == b);
+
+  size_t d = csr.findVertex("d");
+  BOOST_TEST(csr.outOffsets[d] == csr.outOffsets[d + 1]);
+  BOOST_TEST(csr.findVertex("e") == csr.names.size());
+}
+
+BOOST_AUTO_TEST_CASE(RebuiltAfterMutation)
+{
+  Graph graph;
+  graph.addEdge("a", "b", 1);
+  const CsrGraph* first = &graph.snapshot();
+  BOOST_TEST(&graph.snapshot() == first);
+  BOOST_TEST(graph.snapshot().outTargets.size() == 1);
+
+  graph.addEdge("a", "b", 2);
+  BOOST_TEST(graph.snapshot().outTargets.size() == 2);
+
+  BOOST_TEST(!graph.removeEdge("a", "b", 5));
+  BOOST_TEST(graph.removeEdge("a", "b", 1));
+  BOOST_TEST(graph.removeEdge("a", "b", 2));
+  BOOST_TEST(graph.snapshot().outTargets.size() == 0);
+  BOOST_TEST(graph.snapshot().names.size() == 2);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -5,6 +5,28 @@ using namespace averenkov;
 using IntStringTable = HashTable< int, std::string >;
 using StringIntTable = HashTable< std::string, int >;
 
+namespace
+{
+  struct Counted
+  {
+    static int alive;
+    Counted()
+    {
+      ++alive;
+    }
+    Counted(const Counted&)
+    {
+      ++alive;
+    }
+    Counted& operator=(const Counted&) = default;
+    ~Counted()
+    {
+      --alive;
+    }
+  };
+  int Counted::alive = 0;
+}
+
 BOOST_AUTO_TEST_SUITE(HashTableTests)
 
 BOOST_AUTO_TEST_CASE(DefaultConstructor)
@@ -169,4 +191,60 @@ BOOST_AUTO_TEST_CASE(MoveOperations)
   BOOST_TEST(original.empty());
 }
 
+BOOST_AUTO_TEST_CASE(FindAfterManyRehashes)
+{
+  IntStringTable table;
+  for (int i = 0; i < 5000; ++i)
+  {
+    table.insert({ i * 64, std::to_string(i) });
+  }
+  BOOST_TEST(table.size() == 5000);
+  size_t found = 0;
+  for (int i = 0; i < 5000; ++i)
+  {
+    auto it = table.find(i * 64);
+    found += (it != table.end() && it->value == std::to_string(i)) ? 1 : 0;
+  }
+  BOOST_TEST(found == 5000);
+  BOOST_TEST(table.count(1) == 0);
+}
+
+BOOST_AUTO_TEST_CASE(ReserveKeepsElements)
+{
+  StringIntTable table;
+  for (int i = 0; i < 100; ++i)
+  {
+    table.insert({ "key" + std::to_string(i), i });
+  }
+  table.rehash(1);
+  table.reserve(1000);
+  size_t count = 0;
+  for (int i = 0; i < 100; ++i)
+  {
+    count += table.count("key" + std::to_string(i));
+  }
+  BOOST_TEST(count == 100);
+  BOOST_TEST(table.load_factor() <= table.max_load_factor());
+}
+
+BOOST_AUTO_TEST_CASE(PayloadsOnlyInOccupiedSlots)
+{
+  {
+    HashTable< int, Counted > table;
+    BOOST_TEST(Counted::alive == 0);
+    for (int i = 0; i < 100; ++i)
+    {
+      table.emplace(i, Counted());
+    }
+    BOOST_TEST(Counted::alive == 100);
+    HashTable< int, Counted > copy(table);
+    BOOST_TEST(Counted::alive == 200);
+    table.erase(5);
+    BOOST_TEST(Counted::alive == 199);
+    table.clear();
+    BOOST_TEST(Counted::alive == 100);
+  }
+  BOOST_TEST(Counted::alive == 0);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -1,29 +1,160 @@
 #ifndef BUCKET_HPP
 #define BUCKET_HPP
 
+#include <new>
 #include <utility>
 
 namespace averenkov::detail
 {
   template< class Key, class Value >
-  struct Bucket
+  struct Entry
   {
     Key key;
     Value value;
-    bool occupied = false;
-    bool deleted = false;
 
-    Bucket();
+    template< class K, class V >
+    Entry(K&& k, V&& v);
+  };
+
+  template< class Key, class Value >
+  class Bucket
+  {
+  public:
+    Bucket() noexcept;
+    Bucket(const Bucket& other);
+    Bucket& operator=(const Bucket& other);
+    ~Bucket();
+
+    bool is_occupied() const noexcept;
+    bool is_deleted() const noexcept;
+    bool is_free() const noexcept;
+
+    Entry< Key, Value >& entry() noexcept;
+    const Entry< Key, Value >& entry() const noexcept;
+
+    template< class K, class V >
+    void construct(K&& key, V&& value);
+    void erase() noexcept;
+    void reset() noexcept;
+
+  private:
+    enum class State: unsigned char
+    {
+      EMPTY,
+      OCCUPIED,
+      DELETED
+    };
+
+    alignas(Entry< Key, Value >) unsigned char storage_[sizeof(Entry< Key, Value >)];
+    State state_;
+
+    void destroy() noexcept;
   };
 }
 
 template< class Key, class Value >
-averenkov::detail::Bucket< Key, Value >::Bucket():
-  key(Key{}),
-  value(Value{}),
-  occupied(false),
-  deleted(false)
+template< class K, class V >
+averenkov::detail::Entry< Key, Value >::Entry(K&& k, V&& v):
+  key(std::forward< K >(k)),
+  value(std::forward< V >(v))
+{}
+
+template< class Key, class Value >
+averenkov::detail::Bucket< Key, Value >::Bucket() noexcept:
+  state_(State::EMPTY)
 {}
 
+template< class Key, class Value >
+averenkov::detail::Bucket< Key, Value >::Bucket(const Bucket& other):
+  state_(State::EMPTY)
+{
+  if (other.is_occupied())
+  {
+    construct(other.entry().key, other.entry().value);
+  }
+  state_ = other.state_;
+}
+
+template< class Key, class Value >
+averenkov::detail::Bucket< Key, Value >& averenkov::detail::Bucket< Key, Value >::operator=(const Bucket& other)
+{
+  if (this != &other)
+  {
+    reset();
+    if (other.is_occupied())
+    {
+      construct(other.entry().key, other.entry().value);
+    }
+    state_ = other.state_;
+  }
+  return *this;
+}
+
+template< class Key, class Value >
+averenkov::detail::Bucket< Key, Value >::~Bucket()
+{
+  destroy();
+}
+
+template< class Key, class Value >
+bool averenkov::detail::Bucket< Key, Value >::is_occupied() const noexcept
+{
+  return state_ == State::OCCUPIED;
+}
+
+template< class Key, class Value >
+bool averenkov::detail::Bucket< Key, Value >::is_deleted() const noexcept
+{
+  return state_ == State::DELETED;
+}
+
+template< class Key, class Value >
+bool averenkov::detail::Bucket< Key, Value >::is_free() const noexcept
+{
+  return state_ == State::EMPTY;
+}
+
+template< class Key, class Value >
+averenkov::detail::Entry< Key, Value >& averenkov::detail::Bucket< Key, Value >::entry() noexcept
+{
+  return *reinterpret_cast< Entry< Key, Value >* >(storage_);
+}
+
+template< class Key, class Value >
+const averenkov::detail::Entry< Key, Value >& averenkov::detail::Bucket< Key, Value >::entry() const noexcept
+{
+  return *reinterpret_cast< const Entry< Key, Value >* >(storage_);
+}
+
+template< class Key, class Value >
+template< class K, class V >
+void averenkov::detail::Bucket< Key, Value >::construct(K&& key, V&& value)
+{
+  new (storage_) Entry< Key, Value >(std::forward< K >(key), std::forward< V >(value));
+  state_ = State::OCCUPIED;
+}
+
+template< class Key, class Value >
+void averenkov::detail::Bucket< Key, Value >::erase() noexcept
+{
+  destroy();
+  state_ = State::DELETED;
+}
+
+template< class Key, class Value >
+void averenkov::detail::Bucket< Key, Value >::reset() noexcept
+{
+  destroy();
+  state_ = State::EMPTY;
+}
+
+template< class Key, class Value >
+void averenkov::detail::Bucket< Key, Value >::destroy() noexcept
+{
+  if (state_ == State::OCCUPIED)
+  {
+    entry().~Entry< Key, Value >();
+  }
+}
 
 #endif
@@ -0,0 +1,11 @@
+#include "capacity.hpp"
+
+size_t averenkov::next_power_of_two(size_t n) noexcept
+{
+  size_t result = 1;
+  while (result < n)
+  {
+    result <<= 1;
+  }
+  return result;
+}
@@ -0,0 +1,23 @@
+#ifndef CAPACITY_HPP
+#define CAPACITY_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+namespace averenkov
+{
+  size_t next_power_of_two(size_t n) noexcept;
+
+  inline size_t mix_hash(size_t hash) noexcept
+  {
+    uint64_t h = hash;
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return static_cast< size_t >(h);
+  }
+}
+
+#endif
@@ -0,0 +1,120 @@
+#include "csrGraph.hpp"
+#include <algorithm>
+
+namespace
+{
+  struct WeightedEdge
+  {
+    size_t from;
+    size_t to;
+    size_t weight;
+  };
+
+  bool lessBySource(const WeightedEdge& lhs, const WeightedEdge& rhs)
+  {
+    if (lhs.from != rhs.from)
+    {
+      return lhs.from < rhs.from;
+    }
+    if (lhs.to != rhs.to)
+    {
+      return lhs.to < rhs.to;
+    }
+    return lhs.weight < rhs.weight;
+  }
+
+  bool lessByTarget(const WeightedEdge& lhs, const WeightedEdge& rhs)
+  {
+    if (lhs.to != rhs.to)
+    {
+      return lhs.to < rhs.to;
+    }
+    if (lhs.from != rhs.from)
+    {
+      return lhs.from < rhs.from;
+    }
+    return lhs.weight < rhs.weight;
+  }
+
+  void fillRows(averenkov::Array< size_t >& offsets, size_t vertexCount, const averenkov::Array< size_t >& rows)
+  {
+    offsets = averenkov::Array< size_t >(vertexCount + 1);
+    for (size_t i = 0; i < rows.size(); ++i)
+    {
+      ++offsets[rows[i] + 1];
+    }
+    for (size_t i = 0; i < vertexCount; ++i)
+    {
+      offsets[i + 1] += offsets[i];
+    }
+  }
+}
+
+averenkov::CsrGraph::CsrGraph(const Graph& graph):
+  names(graph.vertices.size())
+{
+  size_t vertexCount = 0;
+  for (auto it = graph.vertices.begin(); it != graph.vertices.end(); ++it)
+  {
+    names[vertexCount++] = it->key;
+  }
+  std::sort(names.get_data(), names.get_data() + vertexCount);
+
+  size_t edgeCount = 0;
+  for (auto fromIt = graph.edges.begin(); fromIt != graph.edges.end(); ++fromIt)
+  {
+    for (auto toIt = fromIt->value.begin(); toIt != fromIt->value.end(); ++toIt)
+    {
+      edgeCount += toIt->value.size();
+    }
+  }
+  Array< WeightedEdge > edges(edgeCount);
+  size_t edge = 0;
+  for (auto fromIt = graph.edges.begin(); fromIt != graph.edges.end(); ++fromIt)
+  {
+    size_t from = findVertex(fromIt->key);
+    for (auto toIt = fromIt->value.begin(); toIt != fromIt->value.end(); ++toIt)
+    {
+      size_t to = findVertex(toIt->key);
+      for (size_t i = 0; i < toIt->value.size(); ++i)
+      {
+        edges[edge++] = { from, to, toIt->value[i] };
+      }
+    }
+  }
+
+  Array< size_t > rows(edgeCount);
+  outTargets = Array< size_t >(edgeCount);
+  outWeights = Array< size_t >(edgeCount);
+  std::sort(edges.get_data(), edges.get_data() + edgeCount, lessBySource);
+  for (size_t i = 0; i < edgeCount; ++i)
+  {
+    rows[i] = edges[i].from;
+    outTargets[i] = edges[i].to;
+    outWeights[i] = edges[i].weight;
+  }
+  fillRows(outOffsets, vertexCount, rows);
+
+  inSources = Array< size_t >(edgeCount);
+  inWeights = Array< size_t >(edgeCount);
+  std::sort(edges.get_data(), edges.get_data() + edgeCount, lessByTarget);
+  for (size_t i = 0; i < edgeCount; ++i)
+  {
+    rows[i] = edges[i].to;
+    inSources[i] = edges[i].from;
+    inWeights[i] = edges[i].weight;
+  }
+  fillRows(inOffsets, vertexCount, rows);
+}
+
+size_t averenkov::CsrGraph::findVertex(const std::string& vertex) const
+{
+  const std::string* first = names.get_data();
+  const std::string* last = first + names.size();
+  const std::string* it = std::lower_bound(first, last, vertex);
+  if (it == last || *it != vertex)
+  {
+    return names.size();
+  }
+  return static_cast< size_t >(it - first);
+}
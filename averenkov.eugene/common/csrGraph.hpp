@@ -0,0 +1,25 @@
+#ifndef CSRGRAPH_HPP
+#define CSRGRAPH_HPP
+
+#include <string>
+#include <array.hpp>
+#include <graph.hpp>
+
+namespace averenkov
+{
+  struct CsrGraph
+  {
+    Array< std::string > names;
+    Array< size_t > outOffsets;
+    Array< size_t > outTargets;
+    Array< size_t > outWeights;
+    Array< size_t > inOffsets;
+    Array< size_t > inSources;
+    Array< size_t > inWeights;
+
+    explicit CsrGraph(const Graph& graph);
+    size_t findVertex(const std::string& vertex) const;
+  };
+}
+
+#endif
@@ -1,7 +1,9 @@
 #include "graph.hpp"
+#include "csrGraph.hpp"
 
 void averenkov::Graph::addEdge(const std::string& from, const std::string& to, size_t weight)
 {
+  snapshot_.reset();
   vertices.insert({from, true});
   vertices.insert({to, true});
   auto toMapIt = edges.find(from);
@@ -10,8 +12,8 @@ void averenkov::Graph::addEdge(const std::string& from, const std::string& to, s
     HashTable< std::string, Array< size_t > > newMap;
     Array< size_t > weights;
     weights.push_back(weight);
-    newMap.insert({to, weights});
-    edges.insert({from, newMap});
+    newMap.emplace(to, std::move(weights));
+    edges.emplace(from, std::move(newMap));
   }
   else
   {
@@ -20,7 +22,7 @@ void averenkov::Graph::addEdge(const std::string& from, const std::string& to, s
     {
       Array< size_t > weights;
       weights.push_back(weight);
-      toMapIt->value.insert({to, weights});
+      toMapIt->value.emplace(to, std::move(weights));
     }
     else
     {
@@ -33,7 +35,50 @@ void averenkov::Graph::addVertex(const std::string& vertex)
 {
   if (vertices.find(vertex) == vertices.end())
   {
+    snapshot_.reset();
     vertices.insert({vertex, true});
   }
 }
 
+
+bool averenkov::Graph::removeEdge(const std::string& from, const std::string& to, size_t weight)
+{
+  auto fromIt = edges.find(from);
+  if (fromIt == edges.end())
+  {
+    return false;
+  }
+  auto toIt = fromIt->value.find(to);
+  if (toIt == fromIt->value.end())
+  {
+    return false;
+  }
+  Array< size_t >& weights = toIt->value;
+  for (size_t i = 0; i < weights.size(); ++i)
+  {
+    if (weights[i] == weight)
+    {
+      for (size_t j = i; j < weights.size() - 1; ++j)
+      {
+        weights[j] = weights[j + 1];
+      }
+      weights.pop_back();
+      if (weights.empty())
+      {
+        fromIt->value.erase(to);
+      }
+      snapshot_.reset();
+      return true;
+    }
+  }
+  return false;
+}
+
+const averenkov::CsrGraph& averenkov::Graph::snapshot() const
+{
+  if (!snapshot_)
+  {
+    snapshot_ = std::make_shared< const CsrGraph >(*this);
+  }
+  return *snapshot_;
+}
@@ -2,11 +2,14 @@
 #define GRAPH_HPP
 
 #include <string>
+#include <memory>
 #include <array.hpp>
 #include <hashTable.hpp>
 
 namespace averenkov
 {
+  struct CsrGraph;
+
   struct Graph
   {
     std::string name;
@@ -14,9 +17,13 @@ namespace averenkov
     HashTable< std::string, bool > vertices;
     void addEdge(const std::string& from, const std::string& to, size_t weight);
     void addVertex(const std::string& vertex);
+    bool removeEdge(const std::string& from, const std::string& to, size_t weight);
+    const CsrGraph& snapshot() const;
+
+  private:
+    mutable std::shared_ptr< const CsrGraph > snapshot_;
   };
 
 }
 
 #endif
-
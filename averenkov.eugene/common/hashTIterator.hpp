@@ -19,7 +19,7 @@ namespace averenkov
 
   public:
     using iterator_category = std::forward_iterator_tag;
-    using value_type = std::conditional_t< isConst, const detail::Bucket< Key, Value >, detail::Bucket< Key, Value > >;
+    using value_type = std::conditional_t< isConst, const detail::Entry< Key, Value >, detail::Entry< Key, Value > >;
     using difference_type = std::ptrdiff_t;
     using pointer = value_type*;
     using reference = value_type&;
@@ -78,14 +78,14 @@ template < class Key, class Value, class Hash, class Equal, bool isConst >
 typename averenkov::IteratorHash< Key, Value, Hash, Equal, isConst >::reference
 averenkov::IteratorHash< Key, Value, Hash, Equal, isConst >::operator*() const noexcept
 {
-  return *current_;
+  return current_->entry();
 }
 
 template < class Key, class Value, class Hash, class Equal, bool isConst >
 typename averenkov::IteratorHash< Key, Value, Hash, Equal, isConst >::pointer
 averenkov::IteratorHash< Key, Value, Hash, Equal, isConst >::operator->() const noexcept
 {
-  return current_;
+  return &current_->entry();
 }
 
 template < class Key, class Value, class Hash, class Equal, bool isConst >
@@ -121,7 +121,7 @@ bool averenkov::IteratorHash< Key, Value, Hash, Equal, isConst >::operator!=(con
 template < class Key, class Value, class Hash, class Equal, bool isConst >
 void averenkov::IteratorHash< Key, Value, Hash, Equal, isConst >::skip_empty()
 {
-  while (current_ != end_ && (!current_->occupied || current_->deleted || !is_valid_data(current_)))
+  while (current_ != end_ && (!current_->is_occupied() || !is_valid_data(current_)))
   {
     ++current_;
   }
@@ -133,7 +133,7 @@ bool averenkov::IteratorHash< Key, Value, Hash, Equal, isConst >::is_valid_data(
   try
   {
     static Key dummy;
-    key_equal_(bucket->key, dummy);
+    key_equal_(bucket->entry().key, dummy);
     return true;
   }
   catch (...)
@@ -9,7 +9,7 @@
 #include <bucket.hpp>
 #include <array.hpp>
 #include <hashTIterator.hpp>
-#include <prime.hpp>
+#include <capacity.hpp>
 
 namespace averenkov
 {
@@ -90,12 +90,12 @@ namespace averenkov
   template < class Key, class Value, class Hash, class Equal >
   size_t HashTable< Key, Value, Hash, Equal >::probe(size_t hash, size_t i) const noexcept
   {
-    return (hash + i * i) % table_.size();
+    return (hash + i * (i + 1) / 2) & (table_.size() - 1);
   }
 
   template < class Key, class Value, class Hash, class Equal >
   HashTable< Key, Value, Hash, Equal >::HashTable(size_t bucket_count, const Hash& hash, const Equal& equal):
-    table_(next_prime(bucket_count)),
+    table_(next_power_of_two(bucket_count)),
     hasher_(hash),
     key_equal_(equal)
   {}
@@ -103,7 +103,7 @@ namespace averenkov
 
   template < class Key, class Value, class Hash, class Equal >
   HashTable< Key, Value, Hash, Equal >::HashTable():
-    HashTable(11)
+    HashTable(16)
   {}
 
   template < class Key, class Value, class Hash, class Equal >
@@ -182,7 +182,7 @@ namespace averenkov
   {
     for (size_t i = 0; i < table_.size(); ++i)
     {
-      if (table_[i].occupied && !table_[i].deleted)
+      if (table_[i].is_occupied())
       {
         return iterator(&table_[i], &table_[0] + table_.size());
       }
@@ -217,7 +217,7 @@ namespace averenkov
   {
     for (size_t i = 0; i < table_.size(); ++i)
     {
-      if (table_[i].occupied && !table_[i].deleted)
+      if (table_[i].is_occupied())
       {
         return const_iterator(&table_[i], &table_[0] + table_.size());
       }
@@ -249,8 +249,7 @@ namespace averenkov
   {
     for (size_t i = 0; i < table_.size(); ++i)
     {
-      table_[i].occupied = false;
-      table_[i].deleted = false;
+      table_[i].reset();
     }
     size_ = 0;
   }
@@ -271,27 +270,18 @@ namespace averenkov
     {
       rehash(table_.size() * 2);
     }
-    size_t hash = hasher_(key) % table_.size();
+    size_t hash = hash_to_index(key);
     size_t i = 0;
     size_t index = probe(hash, i);
     size_t first_deleted = table_.size();
 
-    while (table_[index].occupied || table_[index].deleted)
+    while (!table_[index].is_free())
     {
-      if (table_[index].occupied && key_equal_(table_[index].key, key))
+      if (table_[index].is_occupied() && key_equal_(table_[index].entry().key, key))
       {
-        if (table_[index].deleted)
-        {
-          table_[index].key = key;
-          table_[index].value = value;
-          table_[index].occupied = true;
-          table_[index].deleted = false;
-          ++size_;
-          return { iterator(table_.get_data() + index, table_.get_data() + table_.size()), true };
-        }
         return { iterator(table_.get_data() + index, table_.get_data() + table_.size()), false };
       }
-      if (table_[index].deleted && first_deleted == table_.size())
+      if (table_[index].is_deleted() && first_deleted == table_.size())
       {
         first_deleted = index;
       }
@@ -302,10 +292,7 @@ namespace averenkov
     {
       index = first_deleted;
     }
-    table_[index].key = key;
-    table_[index].value = value;
-    table_[index].occupied = true;
-    table_[index].deleted = false;
+    table_[index].construct(std::forward< K >(key), std::forward< V >(value));
     ++size_;
     return { iterator(table_.get_data() + index, table_.get_data() + table_.size()), true };
   }
@@ -336,8 +323,7 @@ namespace averenkov
     }
 
     size_t index = pos.current_ - &table_[0];
-    table_[index].occupied = false;
-    table_[index].deleted = true;
+    table_[index].erase();
     size_--;
 
     auto next = pos;
@@ -406,7 +392,7 @@ namespace averenkov
     auto it = find(key);
     if (it == end())
     {
-      it = insert({ key, Value() }).first;
+      it = emplace(key, Value()).first;
     }
     return it->value;
   }
@@ -417,7 +403,7 @@ namespace averenkov
     auto it = find(key);
     if (it == end())
     {
-      it = insert({ std::move(key), Value() }).first;
+      it = emplace(std::move(key), Value()).first;
     }
     return it->value;
   }
@@ -436,13 +422,13 @@ namespace averenkov
     {
       return end();
     }
-    size_t hash = hasher_(key) % table_.size();
+    size_t hash = hash_to_index(key);
     size_t i = 0;
     size_t index = probe(hash, i);
 
-    while (table_[index].occupied || table_[index].deleted)
+    while (!table_[index].is_free())
     {
-      if (table_[index].occupied && key_equal_(table_[index].key, key))
+      if (table_[index].is_occupied() && key_equal_(table_[index].entry().key, key))
       {
         return iterator(table_.get_data() + index, table_.get_data() + table_.size());
       }
@@ -464,13 +450,13 @@ namespace averenkov
     {
       return cend();
     }
-    size_t hash = hasher_(key) % table_.size();
+    size_t hash = hash_to_index(key);
     size_t i = 0;
     size_t index = probe(hash, i);
 
-    while (table_[index].occupied || table_[index].deleted)
+    while (!table_[index].is_free())
     {
-      if (table_[index].occupied && key_equal_(table_[index].key, key))
+      if (table_[index].is_occupied() && key_equal_(table_[index].entry().key, key))
       {
         return const_iterator(table_.get_data() + index, table_.get_data() + table_.size());
       }
@@ -510,33 +496,25 @@ namespace averenkov
   template < class Key, class Value, class Hash, class Equal >
   void HashTable< Key, Value, Hash, Equal >::rehash(size_t count)
   {
-    count = next_prime(count);
+    count = next_power_of_two(std::max(count, static_cast< size_t >(size_ / max_load_factor_) + 1));
     Array< detail::Bucket < Key, Value > > new_table(count);
-    for (size_t i = 0; i < count; ++i)
-    {
-      new_table.push_back(detail::Bucket< Key, Value >());
-    }
+    size_t mask = count - 1;
 
     for (size_t i = 0; i < table_.size(); ++i)
     {
       auto& bucket = table_[i];
-      if (bucket.occupied && !bucket.deleted)
+      if (bucket.is_occupied())
       {
-        size_t index = hasher_(bucket.key) % count;
+        auto& entry = bucket.entry();
+        size_t index = mix_hash(hasher_(entry.key)) & mask;
         size_t j = 0;
 
-        while (j < count)
+        while (!new_table[index].is_free())
         {
-          size_t current_index = (index + j * j) % count;
-          if (!new_table[current_index].occupied)
-          {
-            new_table[current_index].key = std::move(bucket.key);
-            new_table[current_index].value = std::move(bucket.value);
-            new_table[current_index].occupied = true;
-            break;
-          }
-          j++;
+          ++j;
+          index = (index + j) & mask;
         }
+        new_table[index].construct(std::move(entry.key), std::move(entry.value));
       }
     }
     table_ = std::move(new_table);
@@ -555,7 +533,7 @@ namespace averenkov
     {
       return 0;
     }
-    return hasher_(key) % table_.size();
+    return mix_hash(hasher_(key)) & (table_.size() - 1);
   }
 
   template < class Key, class Value, class Hash, class Equal >
@@ -563,7 +541,7 @@ namespace averenkov
   {
     if (load_factor() > max_load_factor_)
     {
-      rehash(table_.size() * 2 + 1);
+      rehash(table_.size() * 2);
     }
   }
 
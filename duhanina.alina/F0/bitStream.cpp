@@ -0,0 +1,117 @@
+#include "bitStream.hpp"
+#include <stdexcept>
+
+namespace
+{
+  uint64_t low_bits_mask(size_t count)
+  {
+    return (static_cast< uint64_t >(1) << count) - 1;
+  }
+}
+
+constexpr size_t duhanina::BitWriter::MAX_WRITE_BITS;
+constexpr size_t duhanina::BitReader::MAX_PEEK_BITS;
+
+duhanina::BitWriter::BitWriter(std::ostream& output):
+  out(output),
+  buffer(),
+  acc(0),
+  acc_bits(0),
+  total_bits(0)
+{
+  buffer.reserve(STREAM_BLOCK_SIZE + sizeof(uint64_t));
+}
+
+void duhanina::BitWriter::write(uint64_t bits, size_t count)
+{
+  acc = (acc << count) | bits;
+  acc_bits += count;
+  total_bits += count;
+  while (acc_bits >= 8)
+  {
+    acc_bits -= 8;
+    buffer.push_back(static_cast< char >(acc >> acc_bits));
+  }
+  if (buffer.size() >= STREAM_BLOCK_SIZE)
+  {
+    out.write(buffer.data(), buffer.size());
+    buffer.clear();
+  }
+}
+
+void duhanina::BitWriter::flush()
+{
+  if (acc_bits > 0)
+  {
+    buffer.push_back(static_cast< char >(acc << (8 - acc_bits)));
+    acc_bits = 0;
+  }
+  out.write(buffer.data(), buffer.size());
+  buffer.clear();
+}
+
+size_t duhanina::BitWriter::bit_count() const noexcept
+{
+  return total_bits;
+}
+
+duhanina::BitReader::BitReader(std::istream& input, size_t bit_count):
+  in(input),
+  buffer(),
+  buffer_pos(0),
+  acc(0),
+  acc_bits(0),
+  remaining_bits(bit_count)
+{}
+
+uint64_t duhanina::BitReader::peek(size_t count)
+{
+  if (acc_bits < count)
+  {
+    refill();
+  }
+  if (acc_bits >= count)
+  {
+    return (acc >> (acc_bits - count)) & low_bits_mask(count);
+  }
+  return (acc << (count - acc_bits)) & low_bits_mask(count);
+}
+
+void duhanina::BitReader::skip(size_t count)
+{
+  if (acc_bits < count)
+  {
+    refill();
+  }
+  if (acc_bits < count)
+  {
+    throw std::runtime_error("TRUNCATED_FILE");
+  }
+  acc_bits -= count;
+  remaining_bits -= count;
+}
+
+size_t duhanina::BitReader::remaining() const noexcept
+{
+  return remaining_bits;
+}
+
+void duhanina::BitReader::refill()
+{
+  while (acc_bits <= MAX_PEEK_BITS)
+  {
+    if (buffer_pos == buffer.size())
+    {
+      buffer.resize(STREAM_BLOCK_SIZE);
+      in.read(&buffer[0], STREAM_BLOCK_SIZE);
+      buffer.resize(static_cast< size_t >(in.gcount()));
+      buffer_pos = 0;
+      if (buffer.empty())
+      {
+        return;
+      }
+    }
+    acc = (acc << 8) | static_cast< unsigned char >(buffer[buffer_pos++]);
+    acc_bits += 8;
+  }
+}
@@ -0,0 +1,54 @@
+#ifndef BITSTREAM_HPP
+#define BITSTREAM_HPP
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+namespace duhanina
+{
+  constexpr size_t STREAM_BLOCK_SIZE = 1 << 16;
+
+  class BitWriter
+  {
+  public:
+    static constexpr size_t MAX_WRITE_BITS = 56;
+
+    explicit BitWriter(std::ostream& out);
+
+    void write(uint64_t bits, size_t count);
+    void flush();
+    size_t bit_count() const noexcept;
+
+  private:
+    std::ostream& out;
+    std::string buffer;
+    uint64_t acc;
+    size_t acc_bits;
+    size_t total_bits;
+  };
+
+  class BitReader
+  {
+  public:
+    static constexpr size_t MAX_PEEK_BITS = 56;
+
+    BitReader(std::istream& in, size_t bit_count);
+
+    uint64_t peek(size_t count);
+    void skip(size_t count);
+    size_t remaining() const noexcept;
+
+  private:
+    std::istream& in;
+    std::string buffer;
+    size_t buffer_pos;
+    uint64_t acc;
+    size_t acc_bits;
+    size_t remaining_bits;
+
+    void refill();
+  };
+}
+
+#endif
@@ -0,0 +1,198 @@
+#include "codec.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+namespace
+{
+  bool is_binary_code(const std::string& code)
+  {
+    if (code.empty())
+    {
+      return false;
+    }
+    for (size_t i = 0; i < code.size(); i++)
+    {
+      if (code[i] != '0' && code[i] != '1')
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  uint64_t pack_code(const std::string& code, size_t pos, size_t count)
+  {
+    uint64_t bits = 0;
+    for (size_t i = pos; i < pos + count; i++)
+    {
+      bits = (bits << 1) | (code[i] == '1' ? 1 : 0);
+    }
+    return bits;
+  }
+
+  void write_long_code(const std::string& code, duhanina::BitWriter& writer)
+  {
+    for (size_t pos = 0; pos < code.size(); pos += duhanina::BitWriter::MAX_WRITE_BITS)
+    {
+      size_t count = std::min(duhanina::BitWriter::MAX_WRITE_BITS, code.size() - pos);
+      writer.write(pack_code(code, pos, count), count);
+    }
+  }
+}
+
+constexpr size_t duhanina::Decoder::LOOKUP_BITS;
+
+duhanina::Encoder::Encoder(const CodeTable& table)
+{
+  for (auto it = table.char_to_code.cbegin(); it != table.char_to_code.cend(); ++it)
+  {
+    Entry& entry = entries[static_cast< unsigned char >(it->first)];
+    entry.present = true;
+    entry.length = it->second.size();
+    if (entry.length <= BitWriter::MAX_WRITE_BITS)
+    {
+      entry.bits = pack_code(it->second, 0, entry.length);
+    }
+    else
+    {
+      entry.code = it->second;
+    }
+  }
+}
+
+void duhanina::Encoder::encode(const char* data, size_t size, BitWriter& writer) const
+{
+  for (size_t i = 0; i < size; i++)
+  {
+    const Entry& entry = get_entry(data[i]);
+    if (entry.length <= BitWriter::MAX_WRITE_BITS)
+    {
+      writer.write(entry.bits, entry.length);
+    }
+    else
+    {
+      write_long_code(entry.code, writer);
+    }
+  }
+}
+
+size_t duhanina::Encoder::encoded_bits(const std::string& text) const
+{
+  size_t bits = 0;
+  for (size_t i = 0; i < text.size(); i++)
+  {
+    bits += get_entry(text[i]).length;
+  }
+  return bits;
+}
+
+const duhanina::Encoder::Entry& duhanina::Encoder::get_entry(char c) const
+{
+  const Entry& entry = entries[static_cast< unsigned char >(c)];
+  if (!entry.present)
+  {
+    throw std::runtime_error("INVALID_CODES");
+  }
+  return entry;
+}
+
+duhanina::Decoder::Decoder(const CodeTable& table)
+{
+  trie.push_back(TrieNode{ { -1, -1 }, -1 });
+  for (auto it = table.code_to_char.cbegin(); it != table.code_to_char.cend(); ++it)
+  {
+    if (is_binary_code(it->first))
+    {
+      add_code(it->first, it->second);
+    }
+  }
+  build_lookup();
+}
+
+void duhanina::Decoder::decode(BitReader& reader, std::ostream& out) const
+{
+  std::string decoded;
+  decoded.reserve(STREAM_BLOCK_SIZE);
+  while (reader.remaining() > 0)
+  {
+    const LookupEntry& entry = lookup[reader.peek(LOOKUP_BITS)];
+    int node = entry.node;
+    if (entry.length > 0)
+    {
+      if (entry.length > reader.remaining())
+      {
+        throw std::runtime_error("INVALID_CODES");
+      }
+      reader.skip(entry.length);
+    }
+    else
+    {
+      if (node < 0 || reader.remaining() < LOOKUP_BITS)
+      {
+        throw std::runtime_error("INVALID_CODES");
+      }
+      reader.skip(LOOKUP_BITS);
+      while (trie[node].symbol < 0)
+      {
+        if (reader.remaining() == 0)
+        {
+          throw std::runtime_error("INVALID_CODES");
+        }
+        int next = trie[node].children[reader.peek(1)];
+        if (next < 0)
+        {
+          throw std::runtime_error("INVALID_CODES");
+        }
+        reader.skip(1);
+        node = next;
+      }
+    }
+    decoded.push_back(static_cast< char >(trie[node].symbol));
+    if (decoded.size() >= STREAM_BLOCK_SIZE)
+    {
+      out.write(decoded.data(), decoded.size());
+      decoded.clear();
+    }
+  }
+  out.write(decoded.data(), decoded.size());
+}
+
+void duhanina::Decoder::add_code(const std::string& code, char symbol)
+{
+  int node = 0;
+  for (size_t i = 0; i < code.size(); i++)
+  {
+    int bit = code[i] == '1' ? 1 : 0;
+    if (trie[node].children[bit] < 0)
+    {
+      trie[node].children[bit] = static_cast< int >(trie.size());
+      trie.push_back(TrieNode{ { -1, -1 }, -1 });
+    }
+    node = trie[node].children[bit];
+  }
+  trie[node].symbol = static_cast< unsigned char >(symbol);
+}
+
+void duhanina::Decoder::build_lookup()
+{
+  for (size_t index = 0; index < (1u << LOOKUP_BITS); index++)
+  {
+    LookupEntry entry{ 0, 0 };
+    for (size_t depth = 1; depth <= LOOKUP_BITS; depth++)
+    {
+      int next = trie[entry.node].children[(index >> (LOOKUP_BITS - depth)) & 1];
+      if (next < 0)
+      {
+        entry.node = -1;
+        break;
+      }
+      entry.node = next;
+      if (trie[next].symbol >= 0)
+      {
+        entry.length = depth;
+        break;
+      }
+    }
+    lookup[index] = entry;
+  }
+}
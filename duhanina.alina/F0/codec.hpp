@@ -0,0 +1,65 @@
+#ifndef CODEC_HPP
+#define CODEC_HPP
+
+#include <cstdint>
+#include <string>
+#include <iostream>
+#include <array.hpp>
+#include "bitStream.hpp"
+#include "shannonFano.hpp"
+
+namespace duhanina
+{
+  class Encoder
+  {
+  public:
+    explicit Encoder(const CodeTable& table);
+
+    void encode(const char* data, size_t size, BitWriter& writer) const;
+    size_t encoded_bits(const std::string& text) const;
+
+  private:
+    struct Entry
+    {
+      bool present = false;
+      uint64_t bits = 0;
+      size_t length = 0;
+      std::string code;
+    };
+
+    Entry entries[256];
+
+    const Entry& get_entry(char c) const;
+  };
+
+  class Decoder
+  {
+  public:
+    explicit Decoder(const CodeTable& table);
+
+    void decode(BitReader& reader, std::ostream& out) const;
+
+  private:
+    static constexpr size_t LOOKUP_BITS = 10;
+
+    struct TrieNode
+    {
+      int children[2];
+      int symbol;
+    };
+
+    struct LookupEntry
+    {
+      size_t length;
+      int node;
+    };
+
+    DynamicArray< TrieNode > trie;
+    LookupEntry lookup[1 << LOOKUP_BITS];
+
+    void add_code(const std::string& code, char symbol);
+    void build_lookup();
+  };
+}
+
+#endif
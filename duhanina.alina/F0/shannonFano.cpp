@@ -2,9 +2,15 @@
 #include <fstream>
 #include <iomanip>
 #include <cmath>
+#include <cstdio>
 #include <algorithm>
+#include <limits>
+#include <sstream>
+#include <thread>
+#include <future>
 #include <list.hpp>
 #include <array.hpp>
+#include "codec.hpp"
 
 namespace
 {
@@ -15,6 +21,8 @@ namespace
   const std::string TEXT_EXT = ".txt";
   const std::string COMPRESSED_EXT = ".sfano";
   const std::string CODE_TABLE_EXT = ".sfcodes";
+  const std::string BLOCK_MAGIC = "SFPB";
+  const size_t PARALLEL_BLOCK_SIZE = 1 << 20;
 
   void validate_extension(str_t filename, str_t expected_ext)
   {
@@ -25,118 +33,139 @@ namespace
     }
   }
 
-  void build_shannon_fano_codes(duhanina::NodeSymb* node, std::string code, duhanina::Tree< char, std::string, std::less< char > >& codes)
+  using freq_list_t = duhanina::DynamicArray< std::pair< char, size_t > >;
+
+  struct Histogram
   {
-    if (!node)
-    {
-      return;
-    }
-    if (node->left == nullptr && node->right == nullptr)
-    {
-      codes[node->symbol] = code;
-      return;
-    }
-    if (node->left != nullptr)
-    {
-      build_shannon_fano_codes(node->left, code + "0", codes);
-    }
-    if (node->right != nullptr)
-    {
-      build_shannon_fano_codes(node->right, code + "1", codes);
-    }
+    size_t counts[256] = {};
+    size_t total = 0;
+  };
+
+  struct EncodedBlock
+  {
+    std::string bytes;
+    size_t bit_count;
+  };
+
+  size_t default_thread_count()
+  {
+    return std::max(std::thread::hardware_concurrency(), 1u);
   }
 
-  void delete_tree(duhanina::NodeSymb* node)
+  size_t limit_thread_count(size_t threads)
   {
-    if (node != nullptr)
-    {
-      delete_tree(node->left);
-      delete_tree(node->right);
-      delete node;
-    }
+    size_t limit = default_thread_count();
+    return (threads == 0 || threads > limit) ? limit : threads;
+  }
+
+  std::string read_block(std::istream& in, size_t size)
+  {
+    std::string block(size, '\0');
+    in.read(&block[0], size);
+    block.resize(static_cast< size_t >(in.gcount()));
+    return block;
   }
 
-  duhanina::NodeSymb* build_subtree(const duhanina::DynamicArray< duhanina::NodeSymb* >& nodes, size_t start, size_t end)
+  Histogram count_block(const std::string& block)
   {
-    if (start >= end || nodes.empty() || start >= nodes.size())
+    Histogram histogram;
+    for (size_t i = 0; i < block.size(); i++)
     {
-      return nullptr;
+      histogram.counts[static_cast< unsigned char >(block[i])]++;
     }
-    duhanina::NodeSymb* subtree = nodes[start];
-    for (size_t i = start + 1; i < end; i++)
+    histogram.total = block.size();
+    return histogram;
+  }
+
+  Histogram count_file(std::istream& in, size_t threads)
+  {
+    Histogram histogram;
+    while (in)
     {
-      duhanina::NodeSymb* new_node = nullptr;
-      try
+      duhanina::DynamicArray< std::future< Histogram > > batch;
+      for (size_t i = 0; i < threads; i++)
       {
-        new_node = new duhanina::NodeSymb(subtree->freq + nodes[i]->freq, subtree, nodes[i]);
+        std::string block = read_block(in, PARALLEL_BLOCK_SIZE);
+        if (block.empty())
+        {
+          break;
+        }
+        batch.push_back(std::async(std::launch::async, count_block, std::move(block)));
       }
-      catch (...)
+      for (size_t i = 0; i < batch.size(); i++)
       {
-        delete_tree(subtree);
-        throw std::runtime_error("Error memory");
+        Histogram partial = batch[i].get();
+        for (size_t c = 0; c < 256; c++)
+        {
+          histogram.counts[c] += partial.counts[c];
+        }
+        histogram.total += partial.total;
       }
-      subtree = new_node;
     }
-    return subtree;
+    return histogram;
   }
 
-  std::pair< duhanina::NodeSymb*, duhanina::NodeSymb* > split_nodes(const duhanina::DynamicArray< duhanina::NodeSymb* >& nodes)
+  EncodedBlock encode_block(const duhanina::Encoder& encoder, const std::string& text)
   {
-    size_t total = 0;
-    for (size_t i = 0; i < nodes.size(); ++i)
-    {
-      total += nodes[i]->freq;
-    }
-    size_t sum = 0;
-    size_t split_pos = 0;
-    for (; split_pos < nodes.size(); split_pos++)
-    {
-      sum += nodes[split_pos]->freq;
-      if (sum >= total / 2)
-      {
-        break;
-      }
-    }
-    duhanina::NodeSymb* left = build_subtree(nodes, 0, split_pos);
-    duhanina::NodeSymb* right = build_subtree(nodes, split_pos + 1, nodes.size());
-    return { left, right };
+    std::ostringstream out;
+    duhanina::BitWriter writer(out);
+    encoder.encode(text.data(), text.size(), writer);
+    writer.flush();
+    return { out.str(), writer.bit_count() };
+  }
+
+  std::string decode_block(const duhanina::Decoder& decoder, const std::string& bytes, size_t bit_count)
+  {
+    std::istringstream in(bytes);
+    std::ostringstream out;
+    duhanina::BitReader reader(in, bit_count);
+    decoder.decode(reader, out);
+    return out.str();
   }
 
-  duhanina::DynamicArray< duhanina::NodeSymb* > merge_nodes(duhanina::NodeSymb* left, duhanina::NodeSymb* right)
+  void build_shannon_fano_codes(const freq_list_t& symbols, size_t start, size_t end, str_t code, duhanina::CodeTable& table)
   {
-    duhanina::DynamicArray< duhanina::NodeSymb* > new_nodes;
-    if (left)
+    if (end - start == 1)
     {
-      new_nodes.push_back(left);
+      table.char_to_code[symbols[start].first] = code;
+      table.code_to_char[code] = symbols[start].first;
+      return;
+    }
+    size_t total = 0;
+    for (size_t i = start; i < end; i++)
+    {
+      total += symbols[i].second;
     }
-    if (right)
+    size_t sum = symbols[start].second;
+    size_t split_pos = start + 1;
+    while (split_pos < end - 1 && (sum + symbols[split_pos].second) * 2 <= total)
     {
-      new_nodes.push_back(right);
+      sum += symbols[split_pos].second;
+      split_pos++;
     }
-    return new_nodes;
+    build_shannon_fano_codes(symbols, start, split_pos, code + "0", table);
+    build_shannon_fano_codes(symbols, split_pos, end, code + "1", table);
   }
 
-  duhanina::CodeTable build_code_table(str_t text)
+  duhanina::CodeTable build_code_table(const Histogram& histogram)
   {
-    if (text.empty())
+    if (histogram.total == 0)
     {
       throw std::runtime_error("EMPTY");
     }
-    duhanina::Tree< char, size_t, std::less< char > > freq_map;
-    for (size_t i = 0; i < text.size(); i++)
+    freq_list_t sorted_freq;
+    for (int c = std::numeric_limits< char >::min(); c <= std::numeric_limits< char >::max(); c++)
     {
-      char c = text[i];
-      freq_map[c]++;
+      size_t freq = histogram.counts[static_cast< unsigned char >(c)];
+      if (freq > 0)
+      {
+        sorted_freq.push_back(std::make_pair(static_cast< char >(c), freq));
+      }
     }
-    if (freq_map.size() == 1)
+    if (sorted_freq.size() == 1)
     {
       throw std::runtime_error("SINGLE_SYMBOL");
     }
-    duhanina::DynamicArray< std::pair< char, size_t > > sorted_freq;
-    for (auto it = freq_map.begin(); it != freq_map.end(); ++it)
-    {
-      sorted_freq.push_back(*it);
-    }
     for (size_t i = 0; i < sorted_freq.size(); i++)
     {
       for (size_t j = i + 1; j < sorted_freq.size(); j++)
@@ -147,124 +176,24 @@ namespace
         }
       }
     }
-    duhanina::DynamicArray< duhanina::NodeSymb* > nodes;
-    try
-    {
-      for (size_t i = 0; i < sorted_freq.size(); i++)
-      {
-        char ch = sorted_freq[i].first;
-        size_t freq = sorted_freq[i].second;
-        nodes.push_back(new duhanina::NodeSymb(ch, freq));
-      }
-    }
-    catch (...)
-    {
-      for (size_t i = 0; i < nodes.size(); i++)
-      {
-        delete nodes[i];
-        nodes[i] = nullptr;
-      }
-      throw std::runtime_error("Error memory");
-    }
-    while (nodes.size() > 1)
-    {
-      auto node_pair = split_nodes(nodes);
-      nodes = merge_nodes(node_pair.first, node_pair.second);
-    }
     duhanina::CodeTable table;
-    table.total_chars = text.size();
-    build_shannon_fano_codes(nodes[0], "", table.char_to_code);
-    for (auto it = table.char_to_code.begin(); it != table.char_to_code.end(); ++it)
-    {
-      char ch = it->first;
-      std::string code = it->second;
-      table.code_to_char[code] = ch;
-    }
-    delete_tree(nodes[0]);
+    table.total_chars = histogram.total;
+    build_shannon_fano_codes(sorted_freq, 0, sorted_freq.size(), "", table);
     return table;
   }
 
-  std::string encode_text(str_t text, const duhanina::CodeTable& table)
+  void write_size(std::ostream& out, size_t value)
   {
-    std::string encoded;
-    for (size_t i = 0; i < text.size(); i++)
-    {
-      char c = text[i];
-      auto it = table.char_to_code.find(c);
-      if (it == table.char_to_code.cend())
-      {
-        throw std::runtime_error("INVALID_CODES");
-      }
-      encoded += it->second;
-    }
-    return encoded;
-  }
-
-  std::string decode_text(str_t encoded, const duhanina::CodeTable& table)
-  {
-    std::string decoded;
-    std::string current_code;
-    for (size_t i = 0; i < encoded.size(); i++)
-    {
-      char bit = encoded[i];
-      current_code += bit;
-      auto it = table.code_to_char.find(current_code);
-      if (it != table.code_to_char.cend())
-      {
-        decoded += it->second;
-        current_code.clear();
-      }
-    }
-    if (!current_code.empty())
-    {
-      throw std::runtime_error("INVALID_CODES");
-    }
-    return decoded;
-  }
-
-  void write_bits_to_file(str_t bits, str_t filename)
-  {
-    std::ofstream out(filename, std::ios::binary);
-    if (!out)
-    {
-      throw std::runtime_error("INVALID_FILE");
-    }
-    size_t bit_count = bits.size();
     for (size_t i = 0; i < sizeof(size_t); i++)
     {
-      char byte = (bit_count >> (8 * i)) & 0xFF;
+      char byte = (value >> (8 * i)) & 0xFF;
       out.put(byte);
     }
-    char buffer = 0;
-    size_t bit_pos = 0;
-    for (size_t i = 0; i < bits.size(); i++)
-    {
-      if (bits[i] == '1')
-      {
-        buffer |= (1 << (7 - bit_pos));
-      }
-      bit_pos++;
-      if (bit_pos == 8)
-      {
-        out.put(buffer);
-        buffer = 0;
-        bit_pos = 0;
-      }
-    }
-    if (bit_pos > 0)
-    {
-      out.put(buffer);
-    }
   }
 
-  std::string read_bits_from_file(str_t filename)
+  size_t read_size(std::istream& in)
   {
-    std::ifstream in(filename, std::ios::binary);
-    if (!in)
-    {
-      throw std::runtime_error("FILE_NOT_FOUND");
-    }
-    size_t bit_count = 0;
+    size_t value = 0;
     for (size_t i = 0; i < sizeof(size_t); i++)
     {
       char byte;
@@ -272,30 +201,9 @@ namespace
       {
         throw std::runtime_error("INVALID_HEADER");
       }
-      bit_count |= static_cast< size_t >(static_cast< unsigned char >(byte)) << (8 * i);
+      value |= static_cast< size_t >(static_cast< unsigned char >(byte)) << (8 * i);
     }
-    std::string bits;
-    bits.reserve(bit_count);
-    char byte;
-    while (in.get(byte) && bits.size() < bit_count)
-    {
-      for (size_t i = 0; i < 8 && bits.size() < bit_count; i++)
-      {
-        if (byte & (1 << (7 - i)))
-        {
-          bits += '1';
-        }
-        else
-        {
-          bits += '0';
-        }
-      }
-    }
-    if (bits.size() != bit_count)
-    {
-      throw std::runtime_error("TRUNCATED_FILE");
-    }
-    return bits;
+    return value;
   }
 
   void save_code_table(const duhanina::CodeTable& table, str_t filename)
@@ -349,16 +257,38 @@ namespace
     {
       throw std::runtime_error("FILE_NOT_FOUND");
     }
-    std::string text;
-    char ch;
-    while (in.get(ch))
+    duhanina::Encoder encoder(table);
+    std::ofstream out_file(output_file, std::ios::binary);
+    if (!out_file)
     {
-      text += ch;
+      throw std::runtime_error("INVALID_FILE");
     }
-    std::string encoded = encode_text(text, table);
-    write_bits_to_file(encoded, output_file);
-    double original_size = text.size();
-    double compressed_size = std::ceil(encoded.size() / 8.0) + sizeof(size_t);
+    size_t text_size = 0;
+    size_t bit_count = 0;
+    try
+    {
+      write_size(out_file, 0);
+      duhanina::BitWriter writer(out_file);
+      std::string block(duhanina::STREAM_BLOCK_SIZE, '\0');
+      while (in.read(&block[0], block.size()) || in.gcount() > 0)
+      {
+        size_t size = static_cast< size_t >(in.gcount());
+        encoder.encode(block.data(), size, writer);
+        text_size += size;
+      }
+      writer.flush();
+      bit_count = writer.bit_count();
+      out_file.seekp(0);
+      write_size(out_file, bit_count);
+    }
+    catch (...)
+    {
+      out_file.close();
+      std::remove(output_file.c_str());
+      throw;
+    }
+    double original_size = text_size;
+    double compressed_size = std::ceil(bit_count / 8.0) + sizeof(size_t);
     double ratio = (compressed_size / original_size) * 100;
     out << "File successfully compressed:\n";
     out << "Original size: " << original_size << " bytes\n";
@@ -368,14 +298,29 @@ namespace
 
   void decode_file_impl(str_t input_file, str_t output_file, const duhanina::CodeTable& table, std::ostream& out)
   {
-    std::string encoded = read_bits_from_file(input_file);
-    std::string decoded = decode_text(encoded, table);
+    std::ifstream in(input_file, std::ios::binary);
+    if (!in)
+    {
+      throw std::runtime_error("FILE_NOT_FOUND");
+    }
+    size_t bit_count = read_size(in);
+    duhanina::Decoder decoder(table);
     std::ofstream out_file(output_file);
     if (!out_file)
     {
       throw std::runtime_error("INVALID_FILE");
     }
-    out_file << decoded;
+    try
+    {
+      duhanina::BitReader reader(in, bit_count);
+      decoder.decode(reader, out_file);
+    }
+    catch (...)
+    {
+      out_file.close();
+      std::remove(output_file.c_str());
+      throw;
+    }
     out << "File successfully decompressed to '" << output_file << "'\n";
   }
 
@@ -428,13 +373,7 @@ void duhanina::build_codes(str_t input_file, str_t encoding_id, std::ostream& ou
   {
     throw std::runtime_error("FILE_NOT_FOUND");
   }
-  std::string text;
-  char ch;
-  while (in.get(ch))
-  {
-    text += ch;
-  }
-  CodeTable table = build_code_table(text);
+  CodeTable table = build_code_table(count_file(in, default_thread_count()));
   encoding_store[encoding_id] = table;
   out << "Code table successfully built and saved with ID '" << encoding_id << "'\n";
 }
@@ -541,6 +480,152 @@ void duhanina::decode_file(str_t input_file, str_t output_file, str_t encoding_i
   decode_file_impl(input_file, output_file, it->second, out);
 }
 
+void duhanina::encode_file_parallel(str_t input_file, str_t output_file, str_t encoding_id, size_t threads, std::ostream& out)
+{
+  validate_extension(input_file, TEXT_EXT);
+  validate_extension(output_file, COMPRESSED_EXT);
+  auto it = encoding_store.find(encoding_id);
+  if (it == encoding_store.end())
+  {
+    throw std::runtime_error("NO_SUCH_ID");
+  }
+  std::ifstream in(input_file);
+  if (!in)
+  {
+    throw std::runtime_error("FILE_NOT_FOUND");
+  }
+  threads = limit_thread_count(threads);
+  Encoder encoder(it->second);
+  std::ofstream out_file(output_file, std::ios::binary);
+  if (!out_file)
+  {
+    throw std::runtime_error("INVALID_FILE");
+  }
+  size_t text_size = 0;
+  size_t file_size = 0;
+  DynamicArray< std::pair< size_t, size_t > > index;
+  try
+  {
+    out_file << BLOCK_MAGIC;
+    write_size(out_file, 0);
+    while (in)
+    {
+      DynamicArray< std::future< EncodedBlock > > batch;
+      for (size_t i = 0; i < threads; i++)
+      {
+        std::string block = read_block(in, PARALLEL_BLOCK_SIZE);
+        if (block.empty())
+        {
+          break;
+        }
+        text_size += block.size();
+        index.push_back(std::make_pair(block.size(), 0));
+        batch.push_back(std::async(std::launch::async, encode_block, std::cref(encoder), std::move(block)));
+      }
+      for (size_t i = 0; i < batch.size(); i++)
+      {
+        EncodedBlock encoded = batch[i].get();
+        index[index.size() - batch.size() + i].second = encoded.bit_count;
+        out_file.write(encoded.bytes.data(), encoded.bytes.size());
+      }
+    }
+    size_t index_offset = static_cast< size_t >(out_file.tellp());
+    write_size(out_file, index.size());
+    for (size_t i = 0; i < index.size(); i++)
+    {
+      write_size(out_file, index[i].first);
+      write_size(out_file, index[i].second);
+    }
+    file_size = static_cast< size_t >(out_file.tellp());
+    out_file.seekp(BLOCK_MAGIC.size());
+    write_size(out_file, index_offset);
+  }
+  catch (...)
+  {
+    out_file.close();
+    std::remove(output_file.c_str());
+    throw;
+  }
+  double original_size = text_size;
+  double compressed_size = file_size;
+  double ratio = (compressed_size / original_size) * 100;
+  out << "File successfully compressed in " << index.size() << " blocks:\n";
+  out << "Original size: " << original_size << " bytes\n";
+  out << "Compressed size: " << compressed_size << " bytes\n";
+  out << "Compression ratio: " << std::fixed << std::setprecision(2) << ratio << "%\n";
+}
+
+void duhanina::decode_file_parallel(str_t input_file, str_t output_file, str_t encoding_id, size_t threads, std::ostream& out)
+{
+  validate_extension(input_file, COMPRESSED_EXT);
+  validate_extension(output_file, TEXT_EXT);
+  auto it = encoding_store.find(encoding_id);
+  if (it == encoding_store.end())
+  {
+    throw std::runtime_error("NO_SUCH_ID");
+  }
+  std::ifstream in(input_file, std::ios::binary);
+  if (!in)
+  {
+    throw std::runtime_error("FILE_NOT_FOUND");
+  }
+  if (read_block(in, BLOCK_MAGIC.size()) != BLOCK_MAGIC)
+  {
+    throw std::runtime_error("INVALID_HEADER");
+  }
+  size_t data_offset = BLOCK_MAGIC.size() + sizeof(size_t);
+  size_t index_offset = read_size(in);
+  if (index_offset < data_offset || !in.seekg(index_offset))
+  {
+    throw std::runtime_error("INVALID_HEADER");
+  }
+  DynamicArray< std::pair< size_t, size_t > > index;
+  size_t block_count = read_size(in);
+  for (size_t i = 0; i < block_count; i++)
+  {
+    size_t text_size = read_size(in);
+    size_t bit_count = read_size(in);
+    index.push_back(std::make_pair(text_size, bit_count));
+  }
+  in.seekg(data_offset);
+  threads = limit_thread_count(threads);
+  Decoder decoder(it->second);
+  std::ofstream out_file(output_file);
+  if (!out_file)
+  {
+    throw std::runtime_error("INVALID_FILE");
+  }
+  try
+  {
+    for (size_t first = 0; first < index.size(); first += threads)
+    {
+      DynamicArray< std::future< std::string > > batch;
+      for (size_t i = first; i < index.size() && i < first + threads; i++)
+      {
+        size_t bit_count = index[i].second;
+        std::string bytes = read_block(in, (bit_count + 7) / 8);
+        batch.push_back(std::async(std::launch::async, decode_block, std::cref(decoder), std::move(bytes), bit_count));
+      }
+      for (size_t i = 0; i < batch.size(); i++)
+      {
+        std::string decoded = batch[i].get();
+        if (decoded.size() != index[first + i].first)
+        {
+          throw std::runtime_error("INVALID_CODES");
+        }
+        out_file.write(decoded.data(), decoded.size());
+      }
+    }
+  }
+  catch (...)
+  {
+    out_file.close();
+    std::remove(output_file.c_str());
+    throw;
+  }
+  out << "File successfully decompressed to '" << output_file << "'\n";
+}
+
 void duhanina::compare(str_t file1, str_t file2, str_t encod_id1, str_t encod_id2, std::ostream& out)
 {
   validate_extension(file1, TEXT_EXT);
@@ -576,13 +661,13 @@ void duhanina::compare(str_t file1, str_t file2, str_t encod_id1, str_t encod_id
   {
     throw std::runtime_error("IDENTICAL_TEXTS");
   }
-  std::string encoded1 = encode_text(text1, it1->second);
-  std::string encoded2 = encode_text(text2, it2->second);
+  size_t encoded_bits1 = Encoder(it1->second).encoded_bits(text1);
+  size_t encoded_bits2 = Encoder(it2->second).encoded_bits(text2);
   double size1_orig = text1.size();
-  double size1_comp = std::ceil(encoded1.size() / 8.0) + sizeof(size_t);
+  double size1_comp = std::ceil(encoded_bits1 / 8.0) + sizeof(size_t);
   double ratio1 = size1_comp / size1_orig;
   double size2_orig = text2.size();
-  double size2_comp = std::ceil(encoded2.size() / 8.0) + sizeof(size_t);
+  double size2_comp = std::ceil(encoded_bits2 / 8.0) + sizeof(size_t);
   double ratio2 = size2_comp / size2_orig;
   out << "Compression efficiency comparison:\n";
   out << "----------------------------------------\n";
@@ -625,6 +710,8 @@ void duhanina::print_help(std::ostream& out)
   out << "decode_file_with_codes <input> <output> <codes_file> - decompress file\n";
   out << "encode_file <input> <output> <encoding_id> - compress file\n";
   out << "decode_file <input> <output> <encoding_id> - decompress file\n";
+  out << "encode_file_parallel <input> <output> <encoding_id> <threads> - compress file in parallel blocks\n";
+  out << "decode_file_parallel <input> <output> <encoding_id> <threads> - decompress parallel blocks\n";
   out << "compare <file1> <file2> <encoding_id1> <encoding_id2> - compare efficiency\n";
   out << "list_encodings - list all encodings\n";
   out << "check_encoding <input_file> <encoding_id> - verify if encoding supports all file characters\n";
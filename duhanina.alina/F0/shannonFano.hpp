@@ -15,28 +15,6 @@ namespace duhanina
     size_t total_chars = 0;
   };
 
-  struct NodeSymb
-  {
-    char symbol;
-    size_t freq;
-    NodeSymb* left;
-    NodeSymb* right;
-
-    NodeSymb(char s, size_t f):
-      symbol(s),
-      freq(f),
-      left(nullptr),
-      right(nullptr)
-    {}
-
-    NodeSymb(size_t f, NodeSymb* l, NodeSymb* r):
-      symbol(0),
-      freq(f),
-      left(l),
-      right(r)
-    {}
-  };
-
   using str_t = const std::string&;
 
   void print_help(std::ostream& out);
@@ -49,6 +27,8 @@ namespace duhanina
   void decode_file_with_codes(str_t input_file, str_t encoding_name, str_t output_file, std::ostream& out);
   void encode_file(str_t input_file, str_t output_file, str_t encoding_name, std::ostream& out);
   void decode_file(str_t input_file, str_t output_file, str_t encoding_name, std::ostream& out);
+  void encode_file_parallel(str_t input_file, str_t output_file, str_t encoding_name, size_t threads, std::ostream& out);
+  void decode_file_parallel(str_t input_file, str_t output_file, str_t encoding_name, size_t threads, std::ostream& out);
   void compare(str_t file1, str_t file2, str_t encod_name1, str_t encod_name2, std::ostream& out);
   void list_encodings(std::ostream& out);
   void check_encoding(str_t input_file, str_t encoding_id, std::ostream& out);
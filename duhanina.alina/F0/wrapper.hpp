@@ -18,6 +18,8 @@ namespace duhanina
   void decode_file_with_codes_wrapper(std::istream&, std::ostream&);
   void encode_file_wrapper(std::istream&, std::ostream&);
   void decode_file_wrapper(std::istream&, std::ostream&);
+  void encode_file_parallel_wrapper(std::istream&, std::ostream&);
+  void decode_file_parallel_wrapper(std::istream&, std::ostream&);
   void compare_wrapper(std::istream&, std::ostream&);
   void suggest_encodings_wrapper(std::istream& in, std::ostream& out);
   void check_encoding_wrapper(std::istream& in, std::ostream& out);
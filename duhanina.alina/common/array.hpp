@@ -31,6 +31,7 @@ namespace duhanina
     const T& operator[](size_t) const noexcept;
 
     void push_back(const T& value);
+    void push_back(T&& value);
     void pop_back();
     void pop_front();
 
@@ -155,7 +156,7 @@ namespace duhanina
       new_data = new T[new_capacity];
       for (size_t i = 0; i < length_; ++i)
       {
-        new_data[i + head_] = data_[i + head_];
+        new_data[i + head_] = std::move_if_noexcept(data_[i + head_]);
       }
     }
     catch (...)
@@ -179,6 +180,17 @@ namespace duhanina
     ++length_;
   }
 
+  template < typename T >
+  void DynamicArray< T >::push_back(T&& value)
+  {
+    if (length_ == capacity_)
+    {
+      resize();
+    }
+    data_[length_ + head_] = std::move(value);
+    ++length_;
+  }
+
   template < typename T >
   void DynamicArray< T >::pop_back()
   {
@@ -1,11 +1,22 @@
 #include "freq-dict.hpp"
 #include <algorithm>
+#include <cctype>
 #include <fstream>
 #include <functional>
+#include <future>
 #include <iterator>
+#include <thread>
+#include <vector>
+#include <unordered-map.hpp>
 
 namespace kizhin {
-  void appendWord(FrequencyDictionary&, const std::string&);
+  using WordCounter = UnorderedMap< std::string, std::size_t >;
+  using CharIt = std::string::const_iterator;
+  bool isSpace(char);
+  void countWords(WordCounter&, CharIt, CharIt);
+  void countShards(std::vector< WordCounter >&, CharIt, CharIt);
+  void mergeWord(WordCounter&, const WordCounter::value_type&);
+  void appendWord(FrequencyDictionary&, const WordCounter::value_type&);
 }
 
 bool kizhin::SizeDescendingComp::operator()(const WordAndSize& lhs,
@@ -19,24 +30,88 @@ bool kizhin::SizeDescendingComp::operator()(const WordAndSize& lhs,
 
 void kizhin::expandDictionary(std::istream& in, FrequencyDictionary& dict)
 {
-  using InIt = std::istream_iterator< std::string >;
+  constexpr static std::size_t blockSize = 1 << 24;
+  const std::size_t threads = std::max(std::thread::hardware_concurrency(), 1u);
+  std::vector< WordCounter > counters(threads);
+  std::string block{};
+  while (in) {
+    const std::size_t kept = block.size();
+    block.resize(kept + blockSize);
+    in.read(std::addressof(block[kept]), blockSize);
+    block.resize(kept + in.gcount());
+    auto blockEnd = block.cend();
+    if (in) {
+      blockEnd = std::find_if(block.crbegin(), block.crend(), isSpace).base();
+    }
+    countShards(counters, block.cbegin(), blockEnd);
+    block.erase(block.cbegin(), blockEnd);
+  }
   using std::placeholders::_1;
+  WordCounter& result = counters.front();
+  const auto merger = std::bind(std::addressof(mergeWord), std::ref(result), _1);
+  for (auto it = std::next(counters.begin()); it != counters.end(); ++it) {
+    std::for_each(it->begin(), it->end(), merger);
+  }
   const auto appender = std::bind(std::addressof(appendWord), std::ref(dict), _1);
-  std::for_each(InIt{ in }, InIt{}, appender);
+  std::for_each(result.begin(), result.end(), appender);
+}
+
+bool kizhin::isSpace(const char c)
+{
+  return std::isspace(static_cast< unsigned char >(c));
+}
+
+void kizhin::countWords(WordCounter& counter, CharIt first, const CharIt last)
+{
+  std::string word{};
+  first = std::find_if_not(first, last, isSpace);
+  while (first != last) {
+    const CharIt wordEnd = std::find_if(first, last, isSpace);
+    word.assign(first, wordEnd);
+    ++counter[word];
+    first = std::find_if_not(wordEnd, last, isSpace);
+  }
 }
 
-void kizhin::appendWord(FrequencyDictionary& dict, const std::string& word)
+void kizhin::countShards(std::vector< WordCounter >& counters, const CharIt first,
+    const CharIt last)
+{
+  constexpr static std::size_t minShardSize = 1 << 20;
+  const std::size_t size = std::distance(first, last);
+  const std::size_t shards = std::min(counters.size(), size / minShardSize + 1);
+  std::vector< std::future< void > > tasks{};
+  CharIt shardBegin = first;
+  for (std::size_t i = 1; i < shards; ++i) {
+    const CharIt shardEnd = std::find_if(std::next(first, size * i / shards), last, isSpace);
+    if (shardEnd == last) {
+      break;
+    }
+    WordCounter& counter = counters[i];
+    tasks.push_back(std::async(std::launch::async, countWords, std::ref(counter), shardBegin,
+        shardEnd));
+    shardBegin = shardEnd;
+  }
+  countWords(counters.front(), shardBegin, last);
+  std::for_each(tasks.begin(), tasks.end(), std::mem_fn(&std::future< void >::get));
+}
+
+void kizhin::mergeWord(WordCounter& counter, const WordCounter::value_type& word)
+{
+  counter[word.first] += word.second;
+}
+
+void kizhin::appendWord(FrequencyDictionary& dict, const WordCounter::value_type& word)
 {
   WordMap& wordMap = dict.wordMap;
   WordSet& wordSet = dict.wordSet;
   SizeSet& sizeSet = dict.sizeSet;
-  if (!wordMap.count(word)) {
-    wordMap[word] = 0;
-    wordSet.insert(word);
+  std::size_t& wordCount = wordMap[word.first];
+  if (wordCount == 0) {
+    wordSet.insert(word.first);
+  } else {
+    sizeSet.erase({ word.first, wordCount });
   }
-  std::size_t& wordCount = wordMap.at(word);
-  sizeSet.erase({ word, wordCount });
-  sizeSet.insert({ word, ++wordCount });
-  ++dict.total;
+  wordCount += word.second;
+  sizeSet.insert({ word.first, wordCount });
+  dict.total += word.second;
 }
-
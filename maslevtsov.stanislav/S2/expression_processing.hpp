@@ -5,10 +5,9 @@
 #include <stack.hpp>
 
 namespace maslevtsov {
-  using expression_queue = maslevtsov::Queue< maslevtsov::PostfixToken >;
   using results_stack = maslevtsov::Stack< long long >;
 
-  void calculate_expressions(expression_queue& exp_queue, results_stack& results);
+  void calculate_expression(const PostfixToken& expression, results_stack& results);
 }
 
 #endif
@@ -1,16 +1,16 @@
 #include "io_stack.hpp"
 
-void maslevtsov::input_expressions(std::istream& in, expression_queue& exp_queue)
+bool maslevtsov::input_expression(std::istream& in, PostfixToken& expression)
 {
   std::string str;
   while (!in.eof()) {
     std::getline(in, str);
-    if (str.empty()) {
-      continue;
+    if (!str.empty()) {
+      expression = PostfixToken(str);
+      return true;
     }
-    PostfixToken token(str);
-    exp_queue.push(token);
   }
+  return false;
 }
 
 void maslevtsov::output_results(std::ostream& out, results_stack& results) noexcept
@@ -6,10 +6,9 @@
 #include "postfix_token.hpp"
 
 namespace maslevtsov {
-  using expression_queue = maslevtsov::Queue< maslevtsov::PostfixToken >;
   using results_stack = maslevtsov::Stack< long long >;
 
-  void input_expressions(std::istream& in, expression_queue& exp_queue);
+  bool input_expression(std::istream& in, PostfixToken& expression);
   void output_results(std::ostream& out, results_stack& results) noexcept;
 }
 
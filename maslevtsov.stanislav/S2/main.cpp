@@ -10,37 +10,39 @@ int main(int argc, char** argv)
     std::cerr << "Invalid amount of arguments\n";
     return 1;
   }
-  expression_queue exp_queue;
-  try {
-    if (argc == 1) {
-      input_expressions(std::cin, exp_queue);
+  std::ifstream fin;
+  if (argc == 2) {
+    fin.open(argv[1]);
+    if (!fin) {
+      std::cerr << "Invalid input file\n";
+      return 1;
     }
-    if (argc == 2) {
-      std::ifstream fin(argv[1]);
-      if (!fin) {
-        std::cerr << "Invalid input file\n";
-        return 1;
+  }
+  std::istream& in = (argc == 2) ? fin : std::cin;
+
+  results_stack results;
+  PostfixToken expression;
+  while (true) {
+    try {
+      if (!input_expression(in, expression)) {
+        break;
       }
-      input_expressions(fin, exp_queue);
+    } catch (...) {
+      std::cerr << "Incorrect input\n";
+      return 1;
+    }
+    try {
+      calculate_expression(expression, results);
+    } catch (...) {
+      std::cerr << "Calculation error\n";
+      return 1;
     }
-  } catch (...) {
-    std::cerr << "Incorrect input\n";
-    return 1;
   }
 
-  if (exp_queue.empty()) {
+  if (results.empty()) {
     std::cout << '\n';
     return 0;
   }
-
-  results_stack results;
-  try {
-    calculate_expressions(exp_queue, results);
-  } catch (...) {
-    std::cerr << "Calculation error\n";
-    return 1;
-  }
-
   output_results(std::cout, results);
   std::cout << '\n';
 }
@@ -0,0 +1,86 @@
+#include "postfix_program.hpp"
+#include <stdexcept>
+#include <vector/definition.hpp>
+#include "checked_operations.hpp"
+
+maslevtsov::PostfixProgram::PostfixProgram() noexcept:
+  code_(),
+  depth_(0),
+  max_depth_(0)
+{}
+
+void maslevtsov::PostfixProgram::push_operand(long long value)
+{
+  code_.push_back({Opcode::PUSH, value});
+  ++depth_;
+  if (depth_ > max_depth_) {
+    max_depth_ = depth_;
+  }
+}
+
+void maslevtsov::PostfixProgram::push_operation(char operation)
+{
+  Opcode opcode = Opcode::PUSH;
+  switch (operation) {
+  case '+':
+    opcode = Opcode::ADD;
+    break;
+  case '-':
+    opcode = Opcode::SUB;
+    break;
+  case '*':
+    opcode = Opcode::MUL;
+    break;
+  case '/':
+    opcode = Opcode::DIV;
+    break;
+  case '%':
+    opcode = Opcode::REM;
+    break;
+  default:
+    throw std::logic_error("invalid operation");
+  }
+  if (depth_ < 2) {
+    throw std::logic_error("invalid expression");
+  }
+  code_.push_back({opcode, 0});
+  --depth_;
+}
+
+long long maslevtsov::PostfixProgram::operator()() const
+{
+  if (depth_ == 0) {
+    throw std::logic_error("invalid expression");
+  }
+  Vector< long long > stack(max_depth_);
+  std::size_t top = 0;
+  for (auto it = code_.cbegin(); it != code_.cend(); ++it) {
+    if (it->opcode == Opcode::PUSH) {
+      stack[top++] = it->immediate;
+      continue;
+    }
+    --top;
+    long long& left = stack[top - 1];
+    long long right = stack[top];
+    switch (it->opcode) {
+    case Opcode::ADD:
+      left = checked_addition(left, right);
+      break;
+    case Opcode::SUB:
+      left = checked_subtraction(left, right);
+      break;
+    case Opcode::MUL:
+      left = checked_multiplication(left, right);
+      break;
+    case Opcode::DIV:
+      left = checked_division(left, right);
+      break;
+    case Opcode::REM:
+      left = checked_remainder(left, right);
+      break;
+    case Opcode::PUSH:
+      break;
+    }
+  }
+  return stack[top - 1];
+}
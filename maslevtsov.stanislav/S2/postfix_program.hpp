@@ -0,0 +1,40 @@
+#ifndef POSTFIX_PROGRAM_HPP
+#define POSTFIX_PROGRAM_HPP
+
+#include <cstddef>
+#include <vector/declaration.hpp>
+
+namespace maslevtsov {
+  class PostfixProgram
+  {
+  public:
+    PostfixProgram() noexcept;
+
+    void push_operand(long long value);
+    void push_operation(char operation);
+    long long operator()() const;
+
+  private:
+    enum class Opcode: unsigned char
+    {
+      PUSH,
+      ADD,
+      SUB,
+      MUL,
+      DIV,
+      REM,
+    };
+
+    struct Instruction
+    {
+      Opcode opcode;
+      long long immediate;
+    };
+
+    Vector< Instruction > code_;
+    std::size_t depth_;
+    std::size_t max_depth_;
+  };
+}
+
+#endif
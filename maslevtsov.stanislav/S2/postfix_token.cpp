@@ -1,7 +1,7 @@
 #include "postfix_token.hpp"
 #include <sstream>
 #include <stack.hpp>
-#include "checked_operations.hpp"
+#include <vector/definition.hpp>
 
 namespace {
   bool is_operation(const std::string& str) noexcept
@@ -31,7 +31,8 @@ namespace {
 }
 
 maslevtsov::PostfixToken::PostfixToken(const std::string& infix_token):
-  token_()
+  token_(),
+  program_()
 {
   Stack< std::string > dump;
   std::size_t start = 0;
@@ -73,7 +74,8 @@ maslevtsov::PostfixToken::PostfixToken(const std::string& infix_token):
     token_.push(dump.top());
     dump.pop();
   }
-  (*this)();
+  program_ = compile();
+  program_();
 }
 
 maslevtsov::PostfixToken maslevtsov::PostfixToken::operator+(const PostfixToken& other) const
@@ -108,30 +110,27 @@ maslevtsov::PostfixToken maslevtsov::PostfixToken::operator%(const PostfixToken&
 
 long long maslevtsov::PostfixToken::operator()() const
 {
-  Stack< long long > dump;
+  return program_();
+}
+
+maslevtsov::PostfixProgram maslevtsov::PostfixToken::compile() const
+{
+  PostfixProgram program;
   Queue< std::string > exp = token_;
   while (!exp.empty()) {
     if (is_operation(exp.front())) {
-      if (dump.size() < 2) {
-        throw std::logic_error("invalid expression");
-      }
-      long long operand2 = dump.top();
-      dump.pop();
-      long long operand1 = dump.top();
-      dump.pop();
-      dump.push(checked_operation(operand1, operand2, exp.front()));
-      exp.pop();
+      program.push_operation(exp.front()[0]);
     } else {
       std::size_t pos = 0;
       long long operand = std::stoll(exp.front(), &pos);
       if (pos != exp.front().length()) {
         throw std::invalid_argument("invalid operand");
       }
-      dump.push(operand);
-      exp.pop();
+      program.push_operand(operand);
     }
+    exp.pop();
   }
-  return dump.top();
+  return program;
 }
 
 maslevtsov::PostfixToken& maslevtsov::PostfixToken::math_operator_impl(const PostfixToken& other,
@@ -143,5 +142,6 @@ maslevtsov::PostfixToken& maslevtsov::PostfixToken::math_operator_impl(const Pos
     copy.token_.pop();
   }
   token_.push(operation);
+  program_ = compile();
   return *this;
 }
@@ -3,6 +3,7 @@
 
 #include <string>
 #include <queue.hpp>
+#include "postfix_program.hpp"
 
 namespace maslevtsov {
   class PostfixToken
@@ -23,9 +24,11 @@ namespace maslevtsov {
     PostfixToken operator/(const PostfixToken& other) const;
     PostfixToken operator%(const PostfixToken& other) const;
     long long operator()() const;
+    PostfixProgram compile() const;
 
   private:
     Queue< std::string > token_;
+    PostfixProgram program_;
 
     PostfixToken& math_operator_impl(const PostfixToken& other, const std::string& operation);
   };
@@ -0,0 +1,26 @@
+#include <boost/test/unit_test.hpp>
+#include <sstream>
+#include "io_stack.hpp"
+#include "expression_processing.hpp"
+
+BOOST_AUTO_TEST_SUITE(expression_processing_tests)
+BOOST_AUTO_TEST_CASE(streaming_test)
+{
+  std::istringstream in("1 + 2\n\n( 3 + 1 ) * 4\n");
+  maslevtsov::results_stack results;
+  maslevtsov::PostfixToken expression;
+  while (maslevtsov::input_expression(in, expression)) {
+    maslevtsov::calculate_expression(expression, results);
+  }
+  std::ostringstream out;
+  maslevtsov::output_results(out, results);
+  BOOST_TEST(out.str() == "16 3");
+}
+
+BOOST_AUTO_TEST_CASE(invalid_input_test)
+{
+  std::istringstream in("1 +\n");
+  maslevtsov::PostfixToken expression;
+  BOOST_CHECK_THROW(maslevtsov::input_expression(in, expression), std::exception);
+}
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,53 @@
+#include <boost/test/unit_test.hpp>
+#include <limits>
+#include <stdexcept>
+#include <vector/definition.hpp>
+#include "postfix_program.hpp"
+#include "postfix_token.hpp"
+
+BOOST_AUTO_TEST_SUITE(postfix_program_tests)
+BOOST_AUTO_TEST_CASE(evaluation_test)
+{
+  maslevtsov::PostfixProgram program;
+  program.push_operand(7);
+  program.push_operand(2);
+  program.push_operand(3);
+  program.push_operation('*');
+  program.push_operation('-');
+  program.push_operand(4);
+  program.push_operation('%');
+  BOOST_TEST(program() == 1);
+  BOOST_TEST(program() == 1);
+}
+
+BOOST_AUTO_TEST_CASE(compile_test)
+{
+  maslevtsov::PostfixToken exp("( 1 + 2 ) * 3 - 10 / 2");
+  BOOST_TEST(exp.compile()() == 4);
+  BOOST_TEST(maslevtsov::PostfixToken("0 * 5")() == 0);
+  BOOST_TEST(maslevtsov::PostfixToken("1 * 9223372036854775807")() == std::numeric_limits< long long >::max());
+}
+
+BOOST_AUTO_TEST_CASE(invalid_program_test)
+{
+  maslevtsov::PostfixProgram program;
+  program.push_operand(1);
+  BOOST_CHECK_THROW(program.push_operation('+'), std::logic_error);
+  BOOST_CHECK_THROW(program.push_operation('^'), std::logic_error);
+  BOOST_CHECK_THROW(maslevtsov::PostfixProgram()(), std::logic_error);
+}
+
+BOOST_AUTO_TEST_CASE(overflow_test)
+{
+  maslevtsov::PostfixProgram program;
+  program.push_operand(std::numeric_limits< long long >::max());
+  program.push_operand(1);
+  program.push_operation('+');
+  BOOST_CHECK_THROW(program(), std::overflow_error);
+  maslevtsov::PostfixProgram division;
+  division.push_operand(1);
+  division.push_operand(0);
+  division.push_operation('/');
+  BOOST_CHECK_THROW(division(), std::logic_error);
+}
+BOOST_AUTO_TEST_SUITE_END()
@@ -1,4 +1,5 @@
 #include <boost/test/unit_test.hpp>
+#include <string>
 #include "queue.hpp"
 
 BOOST_AUTO_TEST_SUITE(queue_constructors_tests)
@@ -36,6 +37,17 @@ BOOST_AUTO_TEST_CASE(queue_copy_assignment_operator_test)
   BOOST_TEST(q1.front() == q2.front());
   BOOST_TEST(q1.size() == q2.size());
 }
+
+BOOST_AUTO_TEST_CASE(queue_move_assignment_operator_test)
+{
+  maslevtsov::Queue< std::string > q1;
+  q1.push("1");
+  q1.push("2");
+  maslevtsov::Queue< std::string > q2;
+  q2 = std::move(q1);
+  BOOST_TEST(q2.size() == 2);
+  BOOST_TEST(q2.front() == "1");
+}
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE(queue_elements_access_tests)
@@ -106,4 +118,42 @@ BOOST_AUTO_TEST_CASE(queue_swap_test)
   BOOST_TEST(s2.front() == 1);
   BOOST_TEST(s2.size() == 1);
 }
+
+BOOST_AUTO_TEST_CASE(queue_wrapped_push_test)
+{
+  maslevtsov::Queue< std::string > q;
+  int next_push = 0;
+  int next_pop = 0;
+  for (int i = 0; i != 100; ++i) {
+    q.push(std::to_string(next_push++));
+    q.push(std::to_string(next_push++));
+    BOOST_TEST(q.front() == std::to_string(next_pop++));
+    q.pop();
+  }
+  BOOST_TEST(q.size() == 100);
+  maslevtsov::Queue< std::string > copied(q);
+  while (!q.empty()) {
+    BOOST_TEST(q.front() == std::to_string(next_pop));
+    BOOST_TEST(copied.front() == std::to_string(next_pop++));
+    q.pop();
+    copied.pop();
+  }
+}
+
+BOOST_AUTO_TEST_CASE(queue_no_default_constructor_test)
+{
+  struct Value
+  {
+    explicit Value(int value):
+      value_(value)
+    {}
+    int value_;
+  };
+  maslevtsov::Queue< Value > q;
+  for (int i = 0; i != 10; ++i) {
+    q.push(Value(i));
+  }
+  BOOST_TEST(q.front().value_ == 0);
+  BOOST_TEST(q.size() == 10);
+}
 BOOST_AUTO_TEST_SUITE_END()
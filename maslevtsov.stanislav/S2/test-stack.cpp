@@ -1,4 +1,5 @@
 #include <boost/test/unit_test.hpp>
+#include <string>
 #include "stack.hpp"
 
 BOOST_AUTO_TEST_SUITE(stack_constructors_tests)
@@ -98,4 +99,20 @@ BOOST_AUTO_TEST_CASE(stack_swap_test)
   BOOST_TEST(s2.top() == 1);
   BOOST_TEST(s2.size() == 1);
 }
+
+BOOST_AUTO_TEST_CASE(stack_growth_test)
+{
+  maslevtsov::Stack< std::string > s;
+  for (int i = 0; i != 100; ++i) {
+    s.push(std::to_string(i));
+  }
+  maslevtsov::Stack< std::string > moved;
+  moved = std::move(s);
+  BOOST_TEST(moved.size() == 100);
+  for (int i = 99; i >= 0; --i) {
+    BOOST_TEST(moved.top() == std::to_string(i));
+    moved.pop();
+  }
+  BOOST_TEST(moved.empty());
+}
 BOOST_AUTO_TEST_SUITE_END()
@@ -1,19 +1,29 @@
 #include "map_operations.hpp"
 #include <iostream>
 #include <tree/definition.hpp>
+#include <vector/definition.hpp>
+
+namespace {
+  using pairs_t = maslevtsov::Vector< maslevtsov::set_t::value_type >;
+
+  void build_merged(maslevtsov::setmap_t& map, const std::string& newname, const pairs_t& merged)
+  {
+    map[newname] = maslevtsov::set_t(maslevtsov::sorted_unique, merged.cbegin(), merged.cend());
+  }
+}
 
 void maslevtsov::input_setmap(std::istream& in, setmap_t& map)
 {
   std::string setname, value;
   int key = 0;
   while (in) {
-    set_t set;
+    pairs_t pairs;
     in >> setname;
     while (in && in.peek() != '\n') {
       in >> key >> value;
-      set.insert(std::make_pair(key, value));
+      pairs.push_back(std::make_pair(key, value));
     }
-    map.insert(std::make_pair(setname, set));
+    map.insert(std::make_pair(setname, set_t(pairs.cbegin(), pairs.cend())));
   }
 }
 
@@ -21,8 +31,7 @@ void maslevtsov::print_set(std::istream& in, const setmap_t& map)
 {
   std::string setname;
   in >> setname;
-  set_t set;
-  set = map.at(setname);
+  const set_t& set = map.at(setname);
   if (set.empty()) {
     std::cout << "<EMPTY>\n";
     return;
@@ -38,41 +47,69 @@ void maslevtsov::complement_sets(std::istream& in, setmap_t& map)
 {
   std::string newname, setname1, setname2;
   in >> newname >> setname1 >> setname2;
-  set_t set1 = map.at(setname1), set2 = map.at(setname2);
-  set_t newset;
-  for (auto it = set1.cbegin(); it != set1.cend(); ++it) {
-    if (set2.find(it->first) == set2.end()) {
-      newset.insert(std::make_pair(it->first, it->second));
+  const set_t& set1 = map.at(setname1);
+  const set_t& set2 = map.at(setname2);
+  pairs_t merged;
+  auto it1 = set1.cbegin();
+  auto it2 = set2.cbegin();
+  while (it1 != set1.cend()) {
+    if (it2 == set2.cend() || it1->first < it2->first) {
+      merged.push_back(*it1);
+      ++it1;
+    } else if (it2->first < it1->first) {
+      ++it2;
+    } else {
+      ++it1;
+      ++it2;
     }
   }
-  map[newname] = newset;
+  build_merged(map, newname, merged);
 }
 
 void maslevtsov::intersect_sets(std::istream& in, setmap_t& map)
 {
   std::string newname, setname1, setname2;
   in >> newname >> setname1 >> setname2;
-  set_t set1 = map.at(setname1), set2 = map.at(setname2);
-  set_t newset;
-  for (auto it = set1.cbegin(); it != set1.cend(); ++it) {
-    if (set2.find(it->first) != set2.end()) {
-      newset.insert(std::make_pair(it->first, it->second));
+  const set_t& set1 = map.at(setname1);
+  const set_t& set2 = map.at(setname2);
+  pairs_t merged;
+  auto it1 = set1.cbegin();
+  auto it2 = set2.cbegin();
+  while (it1 != set1.cend() && it2 != set2.cend()) {
+    if (it1->first < it2->first) {
+      ++it1;
+    } else if (it2->first < it1->first) {
+      ++it2;
+    } else {
+      merged.push_back(*it1);
+      ++it1;
+      ++it2;
     }
   }
-  map[newname] = newset;
+  build_merged(map, newname, merged);
 }
 
 void maslevtsov::union_sets(std::istream& in, setmap_t& map)
 {
   std::string newname, setname1, setname2;
   in >> newname >> setname1 >> setname2;
-  set_t set1 = map.at(setname1), set2 = map.at(setname2);
-  set_t newset;
-  for (auto it = set1.cbegin(); it != set1.cend(); ++it) {
-    newset.insert(std::make_pair(it->first, it->second));
-  }
-  for (auto it = set2.cbegin(); it != set2.cend(); ++it) {
-    newset.insert(std::make_pair(it->first, it->second));
+  const set_t& set1 = map.at(setname1);
+  const set_t& set2 = map.at(setname2);
+  pairs_t merged;
+  auto it1 = set1.cbegin();
+  auto it2 = set2.cbegin();
+  while (it1 != set1.cend() || it2 != set2.cend()) {
+    if (it2 == set2.cend() || (it1 != set1.cend() && it1->first < it2->first)) {
+      merged.push_back(*it1);
+      ++it1;
+    } else if (it1 == set1.cend() || it2->first < it1->first) {
+      merged.push_back(*it2);
+      ++it2;
+    } else {
+      merged.push_back(*it1);
+      ++it1;
+      ++it2;
+    }
   }
-  map[newname] = newset;
+  build_merged(map, newname, merged);
 }
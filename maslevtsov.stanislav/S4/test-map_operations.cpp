@@ -0,0 +1,58 @@
+#include <sstream>
+#include <boost/test/unit_test.hpp>
+#include <tree/definition.hpp>
+#include "map_operations.hpp"
+
+namespace {
+  maslevtsov::setmap_t make_setmap()
+  {
+    std::istringstream in("first 1 one 3 three 5 five 7 seven\nsecond 2 two 3 drei 7 sieben 8 acht\n");
+    maslevtsov::setmap_t map;
+    maslevtsov::input_setmap(in, map);
+    return map;
+  }
+
+  std::string dump_set(const maslevtsov::set_t& set)
+  {
+    std::string result;
+    for (auto it = set.cbegin(); it != set.cend(); ++it) {
+      result += std::to_string(it->first) + ' ' + it->second + ' ';
+    }
+    return result;
+  }
+}
+
+BOOST_AUTO_TEST_SUITE(map_operations_tests)
+BOOST_AUTO_TEST_CASE(complement_test)
+{
+  maslevtsov::setmap_t map = make_setmap();
+  std::istringstream in("result first second");
+  maslevtsov::complement_sets(in, map);
+  BOOST_TEST(dump_set(map.at("result")) == "1 one 5 five ");
+}
+
+BOOST_AUTO_TEST_CASE(intersect_test)
+{
+  maslevtsov::setmap_t map = make_setmap();
+  std::istringstream in("result first second");
+  maslevtsov::intersect_sets(in, map);
+  BOOST_TEST(dump_set(map.at("result")) == "3 three 7 seven ");
+}
+
+BOOST_AUTO_TEST_CASE(union_test)
+{
+  maslevtsov::setmap_t map = make_setmap();
+  std::istringstream in("result first second");
+  maslevtsov::union_sets(in, map);
+  BOOST_TEST(dump_set(map.at("result")) == "1 one 2 two 3 three 5 five 7 seven 8 acht ");
+}
+
+BOOST_AUTO_TEST_CASE(overwrite_operand_test)
+{
+  maslevtsov::setmap_t map = make_setmap();
+  std::istringstream in("first first second");
+  maslevtsov::intersect_sets(in, map);
+  BOOST_TEST(dump_set(map.at("first")) == "3 three 7 seven ");
+  BOOST_TEST(map.size() == 2);
+}
+BOOST_AUTO_TEST_SUITE_END()
@@ -1,3 +1,5 @@
+#include <map>
+#include <random>
 #include <boost/test/unit_test.hpp>
 #include <tree/definition.hpp>
 
@@ -40,6 +42,42 @@ BOOST_AUTO_TEST_CASE(move_constructor_test)
   BOOST_TEST(tree2.size() == 2);
   BOOST_TEST(tree1.empty());
 }
+
+BOOST_AUTO_TEST_CASE(range_constructor_test)
+{
+  std::pair< int, int > sorted[] = {{1, 10}, {2, 20}, {3, 30}, {4, 40}, {5, 50}};
+  maslevtsov::Tree< int, int > tree1(sorted, sorted + 5);
+  BOOST_TEST(tree1.size() == 5);
+  BOOST_TEST(tree1.nth(2)->second == 30);
+  std::pair< int, int > unsorted[] = {{3, 30}, {1, 10}, {3, 31}, {2, 20}};
+  maslevtsov::Tree< int, int > tree2(unsorted, unsorted + 4);
+  BOOST_TEST(tree2.size() == 3);
+  BOOST_TEST(tree2.at(3) == 30);
+  BOOST_TEST(tree2.cbegin()->first == 1);
+  maslevtsov::Tree< int, int > tree3(sorted, sorted);
+  BOOST_TEST(tree3.empty());
+}
+
+BOOST_AUTO_TEST_CASE(sorted_unique_constructor_test)
+{
+  for (int count = 0; count != 200; ++count) {
+    std::map< int, int > expected;
+    for (int i = 0; i != count; ++i) {
+      expected[i * 3] = i;
+    }
+    maslevtsov::Tree< int, int > tree(maslevtsov::sorted_unique, expected.cbegin(), expected.cend());
+    BOOST_TEST(tree.size() == expected.size());
+    size_t index = 0;
+    for (auto it = expected.cbegin(); it != expected.cend(); ++it, ++index) {
+      BOOST_TEST(tree.nth(index)->first == it->first);
+      BOOST_TEST(tree.rank(it->first) == index);
+    }
+    tree[1] = 1;
+    tree.erase(0);
+    BOOST_TEST(tree.count(1) == 1);
+    BOOST_TEST(tree.count(0) == 0);
+  }
+}
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE(assignment_operators_tests)
@@ -423,3 +461,71 @@ BOOST_AUTO_TEST_CASE(equal_range_test)
   BOOST_TEST(tree.equal_range(1).second->second == 2);
 }
 BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(order_statistics_tests)
+BOOST_AUTO_TEST_CASE(nth_test)
+{
+  maslevtsov::Tree< int, int > tree;
+  for (int i = 9; i >= 0; --i) {
+    tree[i * 2] = i;
+  }
+  for (int i = 0; i != 10; ++i) {
+    BOOST_TEST(tree.nth(i)->first == i * 2);
+  }
+  BOOST_TEST((tree.nth(10) == tree.end()));
+}
+
+BOOST_AUTO_TEST_CASE(rank_test)
+{
+  maslevtsov::Tree< int, int > tree;
+  for (int i = 0; i != 10; ++i) {
+    tree[i * 2] = i;
+  }
+  BOOST_TEST(tree.rank(-1) == 0);
+  BOOST_TEST(tree.rank(0) == 0);
+  BOOST_TEST(tree.rank(5) == 3);
+  BOOST_TEST(tree.rank(6) == 3);
+  BOOST_TEST(tree.rank(100) == 10);
+}
+
+BOOST_AUTO_TEST_CASE(count_range_test)
+{
+  maslevtsov::Tree< int, int > tree;
+  for (int i = 0; i != 10; ++i) {
+    tree[i * 2] = i;
+  }
+  BOOST_TEST(tree.count_range(2, 6) == 3);
+  BOOST_TEST(tree.count_range(1, 7) == 3);
+  BOOST_TEST(tree.count_range(-5, 100) == 10);
+  BOOST_TEST(tree.count_range(6, 2) == 0);
+  BOOST_TEST(tree.count_range(3, 3) == 0);
+}
+
+BOOST_AUTO_TEST_CASE(random_operations_test)
+{
+  std::mt19937 generator(42);
+  maslevtsov::Tree< int, int > tree;
+  std::map< int, int > expected;
+  for (int i = 0; i != 5000; ++i) {
+    int key = generator() % 300;
+    if (generator() % 2) {
+      tree[key] = i;
+      expected[key] = i;
+    } else {
+      BOOST_TEST(tree.erase(key) == expected.erase(key));
+    }
+    BOOST_TEST(tree.size() == expected.size());
+    int lo = generator() % 300;
+    int hi = generator() % 300;
+    size_t expected_rank = std::distance(expected.begin(), expected.lower_bound(lo));
+    BOOST_TEST(tree.rank(lo) == expected_rank);
+    size_t expected_count = hi < lo ? 0 : std::distance(expected.lower_bound(lo), expected.upper_bound(hi));
+    BOOST_TEST(tree.count_range(lo, hi) == expected_count);
+  }
+  size_t index = 0;
+  for (auto it = expected.cbegin(); it != expected.cend(); ++it, ++index) {
+    BOOST_TEST(tree.nth(index)->first == it->first);
+    BOOST_TEST(tree.nth(index)->second == it->second);
+  }
+}
+BOOST_AUTO_TEST_SUITE_END()
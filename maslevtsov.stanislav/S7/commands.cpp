@@ -1,7 +1,7 @@
 #include "commands.hpp"
 #include <vector/definition.hpp>
 #include <tree/definition.hpp>
-#include <hash_table/definition.hpp>
+#include <swiss_table/definition.hpp>
 
 namespace {
   void print_vector(const maslevtsov::Vector< unsigned >& vector, std::ostream& out)
@@ -34,7 +34,7 @@ void maslevtsov::print_vertices(const graphs_map_t& graphs, std::istream& in, st
 {
   std::string graph_name;
   in >> graph_name;
-  Graph graph = graphs.at(graph_name);
+  const Graph& graph = graphs.at(graph_name);
   Tree< std::string, int > names = graph.get_vertices();
   for (auto i = names.cbegin(); i != names.cend(); ++i) {
     out << i->first << '\n';
@@ -48,7 +48,7 @@ void maslevtsov::print_outbound(const graphs_map_t& graphs, std::istream& in, st
 {
   std::string graph_name, vertice_name;
   in >> graph_name >> vertice_name;
-  Graph graph = graphs.at(graph_name);
+  const Graph& graph = graphs.at(graph_name);
   if (!graph.check_vertice_existence(vertice_name)) {
     throw std::invalid_argument("non-existing vertice given");
   }
@@ -67,7 +67,7 @@ void maslevtsov::print_inbound(const graphs_map_t& graphs, std::istream& in, std
 {
   std::string graph_name, vertice_name;
   in >> graph_name >> vertice_name;
-  Graph graph = graphs.at(graph_name);
+  const Graph& graph = graphs.at(graph_name);
   if (!graph.check_vertice_existence(vertice_name)) {
     throw std::invalid_argument("non-existing vertice given");
   }
@@ -137,7 +137,7 @@ void maslevtsov::extract_from_graph(graphs_map_t& graphs, std::istream& in)
   size_t vertice_count = 0;
   in >> vertice_count;
   Vector< std::string > vertices;
-  Graph gr = graphs.at(gr_name);
+  const Graph& gr = graphs.at(gr_name);
   for (size_t i = 0; i != vertice_count; ++i) {
     std::string vertice;
     in >> vertice;
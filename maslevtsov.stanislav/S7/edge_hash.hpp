@@ -0,0 +1,22 @@
+#ifndef EDGE_HASH_HPP
+#define EDGE_HASH_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+namespace maslevtsov {
+  struct EdgeKeyHash
+  {
+    size_t operator()(std::uint64_t key) const noexcept
+    {
+      key ^= key >> 33;
+      key *= 0xff51afd7ed558ccdULL;
+      key ^= key >> 33;
+      key *= 0xc4ceb9fe1a85ec53ULL;
+      key ^= key >> 33;
+      return static_cast< size_t >(key);
+    }
+  };
+}
+
+#endif
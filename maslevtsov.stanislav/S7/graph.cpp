@@ -1,10 +1,15 @@
 #include "graph.hpp"
+#include <stdexcept>
 #include <hash_table/definition.hpp>
 #include <vector/definition.hpp>
 #include <tree/definition.hpp>
+#include <swiss_table/definition.hpp>
 #include <fwd_list/definition.hpp>
 
 namespace {
+  using vertex_id_t = maslevtsov::Graph::vertex_id_t;
+  using edge_key_t = maslevtsov::Graph::edge_key_t;
+
   void sort(maslevtsov::Vector< unsigned >& vector)
   {
     if (vector.empty()) {
@@ -19,13 +24,19 @@ namespace {
     }
   }
 
-  void add_edges(maslevtsov::Graph& dist, const maslevtsov::Graph::edges_set_t& src)
+  edge_key_t make_edge_key(vertex_id_t from, vertex_id_t to) noexcept
   {
-    for (auto i = src.cbegin(); i != src.cend(); ++i) {
-      for (auto j = i->second.cbegin(); j != i->second.cend(); ++j) {
-        dist.bind(i->first.first, i->first.second, *j);
-      }
-    }
+    return (static_cast< edge_key_t >(from) << 32) | to;
+  }
+
+  vertex_id_t get_from(edge_key_t key) noexcept
+  {
+    return static_cast< vertex_id_t >(key >> 32);
+  }
+
+  vertex_id_t get_to(edge_key_t key) noexcept
+  {
+    return static_cast< vertex_id_t >(key);
   }
 
   bool check_bind_existence(const std::string& vertice1, const std::string& vertice2,
@@ -50,17 +61,24 @@ namespace {
 maslevtsov::Graph::Graph(const Graph& src1, const Graph& src2):
   Graph()
 {
-  add_edges(*this, src1.edges_set_);
-  add_edges(*this, src2.edges_set_);
+  add_edges(src1);
+  add_edges(src2);
 }
 
 maslevtsov::Graph::Graph(const Graph& src, Vector< std::string >& vertices):
   Graph()
 {
   for (auto i = src.edges_set_.cbegin(); i != src.edges_set_.cend(); ++i) {
-    if (check_bind_existence(i->first.first, i->first.second, vertices)) {
+    if (i->second.empty()) {
+      continue;
+    }
+    const std::string& from_name = src.names_[get_from(i->first)];
+    const std::string& to_name = src.names_[get_to(i->first)];
+    if (check_bind_existence(from_name, to_name, vertices)) {
+      vertex_id_t from = intern(from_name);
+      vertex_id_t to = intern(to_name);
       for (auto j = i->second.cbegin(); j != i->second.cend(); ++j) {
-        bind(i->first.first, i->first.second, *j);
+        bind(from, to, *j);
       }
     }
   }
@@ -69,9 +87,8 @@ maslevtsov::Graph::Graph(const Graph& src, Vector< std::string >& vertices):
 maslevtsov::Tree< std::string, int > maslevtsov::Graph::get_vertices() const
 {
   Tree< std::string, int > vertices;
-  for (auto i = edges_set_.cbegin(); i != edges_set_.cend(); ++i) {
-    vertices[i->first.first];
-    vertices[i->first.second];
+  for (auto i = names_.cbegin(); i != names_.cend(); ++i) {
+    vertices[*i];
   }
   return vertices;
 }
@@ -79,46 +96,25 @@ maslevtsov::Tree< std::string, int > maslevtsov::Graph::get_vertices() const
 maslevtsov::Tree< std::string, maslevtsov::Graph::weights_t >
   maslevtsov::Graph::get_outbound(const std::string& vertice) const
 {
-  Tree< std::string, weights_t > outbound;
-  for (auto i = edges_set_.cbegin(); i != edges_set_.cend(); ++i) {
-    if (i->first.first == vertice && !i->second.empty()) {
-      for (auto j = i->second.cbegin(); j != i->second.cend(); ++j) {
-        outbound[i->first.second].push_back(*j);
-      }
-      sort(outbound[i->first.second]);
-    }
-  }
-  return outbound;
+  return get_adjacent(outbound_, vertice, true);
 }
 
 maslevtsov::Tree< std::string, maslevtsov::Graph::weights_t >
   maslevtsov::Graph::get_inbound(const std::string& vertice) const
 {
-  Tree< std::string, weights_t > outbound;
-  for (auto i = edges_set_.cbegin(); i != edges_set_.cend(); ++i) {
-    if (i->first.second == vertice && !i->second.empty()) {
-      for (auto j = i->second.cbegin(); j != i->second.cend(); ++j) {
-        outbound[i->first.first].push_back(*j);
-      }
-      sort(outbound[i->first.first]);
-    }
-  }
-  return outbound;
+  return get_adjacent(inbound_, vertice, false);
 }
 
 void maslevtsov::Graph::bind(const std::string& vertice1, const std::string& vertice2, unsigned weight)
 {
-  edges_set_[std::make_pair(vertice1, vertice2)].push_back(weight);
+  vertex_id_t from = intern(vertice1);
+  vertex_id_t to = intern(vertice2);
+  bind(from, to, weight);
 }
 
-bool maslevtsov::Graph::check_vertice_existence(const std::string& vertice)
+bool maslevtsov::Graph::check_vertice_existence(const std::string& vertice) const
 {
-  for (auto it = edges_set_.begin(); it != edges_set_.end(); ++it) {
-    if (it->first.first == vertice || it->first.second == vertice) {
-      return true;
-    }
-  }
-  return false;
+  return ids_.find(vertice) != ids_.cend();
 }
 
 void maslevtsov::Graph::add_vertice(const std::string& vertice)
@@ -131,7 +127,12 @@ void maslevtsov::Graph::add_vertice(const std::string& vertice)
 
 void maslevtsov::Graph::cut(const std::string& vertice1, const std::string& vertice2, unsigned weight)
 {
-  auto to_cut_it = edges_set_.find(std::make_pair(vertice1, vertice2));
+  auto from_it = ids_.find(vertice1);
+  auto to_it = ids_.find(vertice2);
+  if (from_it == ids_.end() || to_it == ids_.end()) {
+    throw std::invalid_argument("non-existing edge given");
+  }
+  auto to_cut_it = edges_set_.find(make_edge_key(from_it->second, to_it->second));
   if (to_cut_it == edges_set_.end()) {
     throw std::invalid_argument("non-existing edge given");
   }
@@ -148,3 +149,65 @@ void maslevtsov::Graph::cut(const std::string& vertice1, const std::string& vert
     throw std::invalid_argument("non-existing weight given");
   }
 }
+
+maslevtsov::Graph::vertex_id_t maslevtsov::Graph::intern(const std::string& vertice)
+{
+  auto it = ids_.find(vertice);
+  if (it != ids_.end()) {
+    return it->second;
+  }
+  vertex_id_t id = static_cast< vertex_id_t >(names_.size());
+  names_.push_back(vertice);
+  outbound_.push_back(Vector< vertex_id_t >());
+  inbound_.push_back(Vector< vertex_id_t >());
+  ids_.insert(std::make_pair(vertice, id));
+  return id;
+}
+
+void maslevtsov::Graph::bind(vertex_id_t vertice1, vertex_id_t vertice2, unsigned weight)
+{
+  edge_key_t key = make_edge_key(vertice1, vertice2);
+  auto edge_it = edges_set_.find(key);
+  if (edge_it == edges_set_.end()) {
+    edge_it = edges_set_.insert(std::make_pair(key, weights_t())).first;
+    outbound_[vertice1].push_back(vertice2);
+    inbound_[vertice2].push_back(vertice1);
+  }
+  edge_it->second.push_back(weight);
+}
+
+void maslevtsov::Graph::add_edges(const Graph& src)
+{
+  for (auto i = src.edges_set_.cbegin(); i != src.edges_set_.cend(); ++i) {
+    if (i->second.empty()) {
+      continue;
+    }
+    vertex_id_t from = intern(src.names_[get_from(i->first)]);
+    vertex_id_t to = intern(src.names_[get_to(i->first)]);
+    for (auto j = i->second.cbegin(); j != i->second.cend(); ++j) {
+      bind(from, to, *j);
+    }
+  }
+}
+
+maslevtsov::Tree< std::string, maslevtsov::Graph::weights_t > maslevtsov::Graph::get_adjacent(
+  const adjacency_t& adjacency, const std::string& vertice, bool is_outbound) const
+{
+  Tree< std::string, weights_t > result;
+  auto id_it = ids_.find(vertice);
+  if (id_it == ids_.cend()) {
+    return result;
+  }
+  vertex_id_t id = id_it->second;
+  const Vector< vertex_id_t >& adjacent = adjacency[id];
+  for (auto i = adjacent.cbegin(); i != adjacent.cend(); ++i) {
+    edge_key_t key = is_outbound ? make_edge_key(id, *i) : make_edge_key(*i, id);
+    const weights_t& weights = edges_set_.at(key);
+    if (!weights.empty()) {
+      weights_t& sorted = result[names_[*i]];
+      sorted = weights;
+      sort(sorted);
+    }
+  }
+  return result;
+}
@@ -1,19 +1,23 @@
 #ifndef GRAPH_HPP
 #define GRAPH_HPP
 
+#include <cstdint>
 #include <string>
 #include <hash_table/declaration.hpp>
 #include <vector/declaration.hpp>
 #include <tree/declaration.hpp>
-#include "pair_hash.hpp"
+#include <swiss_table/declaration.hpp>
+#include "edge_hash.hpp"
 
 namespace maslevtsov {
   class Graph
   {
   public:
-    using vertices_pair_t = std::pair< std::string, std::string >;
+    using vertex_id_t = std::uint32_t;
+    using edge_key_t = std::uint64_t;
     using weights_t = Vector< unsigned >;
-    using edges_set_t = maslevtsov::HashTable< vertices_pair_t, weights_t, PairStringStdHash, PairStringSipHash >;
+    using edges_set_t = maslevtsov::SwissTable< edge_key_t, weights_t, EdgeKeyHash >;
+    using adjacency_t = Vector< Vector< vertex_id_t > >;
 
     Graph() = default;
     Graph(const Graph& src1, const Graph& src2);
@@ -23,12 +27,22 @@ namespace maslevtsov {
     Tree< std::string, weights_t > get_outbound(const std::string& vertice) const;
     Tree< std::string, weights_t > get_inbound(const std::string& vertice) const;
     void bind(const std::string& vertice1, const std::string& vertice2, unsigned weight);
-    bool check_vertice_existence(const std::string& vertice);
+    bool check_vertice_existence(const std::string& vertice) const;
     void add_vertice(const std::string& vertice);
     void cut(const std::string& vertice1, const std::string& vertice2, unsigned weight);
 
   private:
+    Vector< std::string > names_;
+    HashTable< std::string, vertex_id_t > ids_;
     edges_set_t edges_set_;
+    adjacency_t outbound_;
+    adjacency_t inbound_;
+
+    vertex_id_t intern(const std::string& vertice);
+    void bind(vertex_id_t vertice1, vertex_id_t vertice2, unsigned weight);
+    void add_edges(const Graph& src);
+    Tree< std::string, weights_t > get_adjacent(const adjacency_t& adjacency, const std::string& vertice,
+      bool is_outbound) const;
   };
 }
 
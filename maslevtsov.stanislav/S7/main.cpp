@@ -2,6 +2,7 @@
 #include <iostream>
 #include <limits>
 #include <hash_table/definition.hpp>
+#include <swiss_table/definition.hpp>
 #include "graph.hpp"
 #include "bind_functor.hpp"
 #include "commands.hpp"
@@ -0,0 +1,82 @@
+#include <boost/test/unit_test.hpp>
+#include <string>
+#include <hash_table/definition.hpp>
+#include <swiss_table/definition.hpp>
+#include <tree/definition.hpp>
+#include <vector/definition.hpp>
+#include "graph.hpp"
+
+BOOST_AUTO_TEST_SUITE(graph_tests)
+BOOST_AUTO_TEST_CASE(outbound_inbound_test)
+{
+  maslevtsov::Graph graph;
+  graph.bind("a", "b", 3);
+  graph.bind("a", "b", 1);
+  graph.bind("a", "c", 2);
+  graph.bind("c", "a", 4);
+  auto outbound = graph.get_outbound("a");
+  BOOST_TEST(outbound.size() == 2);
+  BOOST_TEST(outbound.at("b").size() == 2);
+  BOOST_TEST(outbound.at("b")[0] == 1);
+  BOOST_TEST(outbound.at("b")[1] == 3);
+  BOOST_TEST(outbound.at("c")[0] == 2);
+  auto inbound = graph.get_inbound("a");
+  BOOST_TEST(inbound.size() == 1);
+  BOOST_TEST(inbound.at("c")[0] == 4);
+  BOOST_TEST(graph.get_outbound("b").empty());
+  BOOST_TEST(graph.get_inbound("b").size() == 1);
+}
+
+BOOST_AUTO_TEST_CASE(cut_test)
+{
+  maslevtsov::Graph graph;
+  graph.bind("a", "b", 1);
+  graph.bind("a", "c", 2);
+  graph.cut("a", "b", 1);
+  auto outbound = graph.get_outbound("a");
+  BOOST_TEST(outbound.size() == 1);
+  BOOST_TEST((outbound.find("b") == outbound.end()));
+  BOOST_TEST(graph.get_inbound("b").empty());
+  BOOST_TEST(graph.check_vertice_existence("b"));
+}
+
+BOOST_AUTO_TEST_CASE(cut_extract_merge_test)
+{
+  maslevtsov::Graph graph;
+  graph.bind("a", "b", 1);
+  graph.bind("c", "d", 2);
+  graph.cut("a", "b", 1);
+  maslevtsov::Vector< std::string > vertices;
+  vertices.push_back("a");
+  vertices.push_back("b");
+  vertices.push_back("c");
+  vertices.push_back("d");
+  maslevtsov::Graph extracted(graph, vertices);
+  BOOST_TEST(extracted.get_vertices().size() == 2);
+  BOOST_TEST(!extracted.check_vertice_existence("a"));
+  BOOST_TEST(!extracted.check_vertice_existence("b"));
+  maslevtsov::Graph other;
+  other.bind("x", "y", 3);
+  maslevtsov::Graph merged(graph, other);
+  BOOST_TEST(merged.get_vertices().size() == 4);
+  BOOST_TEST(!merged.check_vertice_existence("a"));
+  BOOST_TEST(merged.get_outbound("c").at("d")[0] == 2);
+}
+
+BOOST_AUTO_TEST_CASE(vertices_test)
+{
+  maslevtsov::Graph graph;
+  for (size_t i = 0; i < 100; ++i) {
+    graph.bind(std::to_string(i), std::to_string((i + 1) % 100), i);
+  }
+  graph.add_vertice("x");
+  BOOST_TEST(graph.get_vertices().size() == 101);
+  BOOST_TEST(graph.check_vertice_existence("x"));
+  BOOST_TEST(!graph.check_vertice_existence("y"));
+  for (size_t i = 0; i < 100; ++i) {
+    auto outbound = graph.get_outbound(std::to_string(i));
+    BOOST_TEST(outbound.size() == 1);
+    BOOST_TEST(outbound.at(std::to_string((i + 1) % 100))[0] == i);
+  }
+}
+BOOST_AUTO_TEST_SUITE_END()
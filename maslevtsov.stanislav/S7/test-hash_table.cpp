@@ -216,4 +216,24 @@ BOOST_AUTO_TEST_CASE(rehash_test)
   table.rehash(62);
   BOOST_TEST(table.load_factor() == 0.0625);
 }
+
+BOOST_AUTO_TEST_CASE(churn_test)
+{
+  maslevtsov::HashTable< int, int > table;
+  for (int i = 0; i != 8; ++i) {
+    table[i] = i;
+  }
+  for (int i = 8; i != 10008; ++i) {
+    BOOST_TEST(table.erase(i - 8) == 1);
+    table[i] = i;
+    BOOST_TEST(table.size() == 8);
+  }
+  BOOST_TEST(table.load_factor() == 0.5);
+  for (int i = 0; i != 10000; ++i) {
+    BOOST_TEST((table.find(i) == table.end()));
+  }
+  for (int i = 10000; i != 10008; ++i) {
+    BOOST_TEST(table.at(i) == i);
+  }
+}
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,100 @@
+#include <boost/test/unit_test.hpp>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <swiss_table/definition.hpp>
+
+BOOST_AUTO_TEST_SUITE(swiss_table_tests)
+BOOST_AUTO_TEST_CASE(insert_find_test)
+{
+  maslevtsov::SwissTable< int, int > table = {{0, 0}, {1, 1}};
+  BOOST_TEST(table.size() == 2);
+  BOOST_TEST(table.find(0)->second == 0);
+  BOOST_TEST(table.find(1)->second == 1);
+  BOOST_TEST((table.find(2) == table.end()));
+  BOOST_TEST(!table.insert({1, 2}).second);
+  table[2] = 2;
+  BOOST_TEST(table.at(2) == 2);
+  BOOST_TEST(table.size() == 3);
+}
+
+BOOST_AUTO_TEST_CASE(iteration_test)
+{
+  maslevtsov::SwissTable< std::string, int > table;
+  for (int i = 0; i != 100; ++i) {
+    table[std::to_string(i)] = i;
+  }
+  int sum = 0;
+  size_t count = 0;
+  for (auto it = table.cbegin(); it != table.cend(); ++it) {
+    BOOST_TEST(std::to_string(it->second) == it->first);
+    sum += it->second;
+    ++count;
+  }
+  BOOST_TEST(count == 100);
+  BOOST_TEST(sum == 4950);
+}
+
+BOOST_AUTO_TEST_CASE(erase_test)
+{
+  maslevtsov::SwissTable< int, int > table;
+  for (int i = 0; i != 1000; ++i) {
+    table[i] = i;
+  }
+  for (int i = 0; i != 1000; i += 2) {
+    BOOST_TEST(table.erase(i) == 1);
+  }
+  BOOST_TEST(table.erase(0) == 0);
+  BOOST_TEST(table.size() == 500);
+  for (int i = 0; i != 1000; ++i) {
+    BOOST_TEST(((table.find(i) == table.end()) == (i % 2 == 0)));
+  }
+  table.clear();
+  BOOST_TEST(table.empty());
+  BOOST_TEST((table.begin() == table.end()));
+}
+
+BOOST_AUTO_TEST_CASE(payload_lifetime_test)
+{
+  auto payload = std::make_shared< int >(0);
+  maslevtsov::SwissTable< int, std::shared_ptr< int > > table;
+  BOOST_TEST(payload.use_count() == 1);
+  for (int i = 0; i != 100; ++i) {
+    table[i] = payload;
+  }
+  BOOST_TEST(payload.use_count() == 101);
+  for (int i = 0; i != 100; i += 2) {
+    table.erase(i);
+  }
+  BOOST_TEST(payload.use_count() == 51);
+  maslevtsov::SwissTable< int, std::shared_ptr< int > > copied(table);
+  BOOST_TEST(payload.use_count() == 101);
+  BOOST_TEST((copied.find(0) == copied.end()));
+  BOOST_TEST(copied.at(1) == payload);
+  copied.clear();
+  BOOST_TEST(payload.use_count() == 51);
+  table = std::move(copied);
+  BOOST_TEST(payload.use_count() == 1);
+}
+
+BOOST_AUTO_TEST_CASE(oracle_test)
+{
+  maslevtsov::SwissTable< unsigned, unsigned > table;
+  std::unordered_map< unsigned, unsigned > oracle;
+  unsigned state = 1;
+  for (size_t i = 0; i != 20000; ++i) {
+    state = state * 1103515245 + 12345;
+    unsigned key = (state >> 8) % 3000;
+    if (state % 3 == 0) {
+      BOOST_TEST(table.erase(key) == oracle.erase(key));
+    } else {
+      table[key] = i;
+      oracle[key] = i;
+    }
+  }
+  BOOST_TEST(table.size() == oracle.size());
+  for (auto it = oracle.cbegin(); it != oracle.cend(); ++it) {
+    BOOST_TEST(table.at(it->first) == it->second);
+  }
+}
+BOOST_AUTO_TEST_SUITE_END()
@@ -67,12 +67,15 @@ namespace maslevtsov {
 
     Vector< detail::Slot< value_type > > slots_;
     size_type size_;
+    size_type deleted_;
     Hash hasher_;
     ProbeHash probe_hasher_;
     KeyEqual key_equal_;
     float max_load_factor_ = 1.0;
 
     size_type find_index(const Key& key) const noexcept;
+    bool has_excess_tombstones() const noexcept;
+    void rebuild(size_type count);
   };
 }
 
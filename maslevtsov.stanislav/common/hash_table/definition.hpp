@@ -18,7 +18,8 @@ namespace maslevtsov {
 template< class Key, class T, class Hash, class ProbeHash, class KeyEqual >
 maslevtsov::HashTable< Key, T, Hash, ProbeHash, KeyEqual >::HashTable() noexcept:
   slots_(16),
-  size_(0)
+  size_(0),
+  deleted_(0)
 {}
 
 template< class Key, class T, class Hash, class ProbeHash, class KeyEqual >
@@ -144,6 +145,7 @@ void maslevtsov::HashTable< Key, T, Hash, ProbeHash, KeyEqual >::clear() noexcep
     slots_[i].state = detail::SlotState::EMPTY;
   }
   size_ = 0;
+  deleted_ = 0;
 }
 
 template< class Key, class T, class Hash, class ProbeHash, class KeyEqual >
@@ -178,6 +180,8 @@ std::pair< typename maslevtsov::HashTable< Key, T, Hash, ProbeHash, KeyEqual >::
   const Key& key = value.first;
   if (load_factor() >= max_load_factor_) {
     rehash(slots_.size() * 2);
+  } else if (has_excess_tombstones()) {
+    rebuild(slots_.size());
   }
   size_t index = find_index(key);
   if (index != slots_.size()) {
@@ -192,6 +196,7 @@ std::pair< typename maslevtsov::HashTable< Key, T, Hash, ProbeHash, KeyEqual >::
         slots_[first_deleted].data = value;
         slots_[first_deleted].state = detail::SlotState::OCCUPIED;
         ++size_;
+        --deleted_;
         return {iterator(this, first_deleted), true};
       } else {
         slots_[index].data = value;
@@ -210,6 +215,7 @@ std::pair< typename maslevtsov::HashTable< Key, T, Hash, ProbeHash, KeyEqual >::
     slots_[first_deleted].data = value;
     slots_[first_deleted].state = detail::SlotState::OCCUPIED;
     ++size_;
+    --deleted_;
     return {iterator(this, first_deleted), true};
   }
   throw std::runtime_error("hash-table is full");
@@ -236,6 +242,7 @@ typename maslevtsov::HashTable< Key, T, Hash, ProbeHash, KeyEqual >::iterator
 {
   slots_[pos.index_].state = detail::SlotState::DELETED;
   --size_;
+  ++deleted_;
   return ++pos;
 }
 
@@ -275,6 +282,7 @@ void maslevtsov::HashTable< Key, T, Hash, ProbeHash, KeyEqual >::swap(HashTable&
 {
   std::swap(slots_, other.slots_);
   std::swap(size_, other.size_);
+  std::swap(deleted_, other.deleted_);
   std::swap(hasher_, other.hasher_);
   std::swap(probe_hasher_, other.probe_hasher_);
   std::swap(key_equal_, other.key_equal_);
@@ -314,19 +322,7 @@ void maslevtsov::HashTable< Key, T, Hash, ProbeHash, KeyEqual >::rehash(size_typ
     }
     count = new_count;
   }
-  Vector< detail::Slot< value_type > > new_slots(count);
-  for (auto it = slots_.begin(); it != slots_.end(); ++it) {
-    if (it->state == detail::SlotState::OCCUPIED) {
-      const Key& key = it->data.first;
-      size_t index = hasher_(key) % new_slots.size();
-      size_t odd_step = detail::get_odd_step(key, slots_.size(), probe_hasher_);
-      while (new_slots[index].state == detail::SlotState::OCCUPIED) {
-        index = (index + odd_step) % new_slots.size();
-      }
-      new_slots[index] = *it;
-    }
-  }
-  slots_ = new_slots;
+  rebuild(count);
 }
 
 template< class Key, class T, class Hash, class ProbeHash, class KeyEqual >
@@ -347,4 +343,37 @@ typename maslevtsov::HashTable< Key, T, Hash, ProbeHash, KeyEqual >::size_type
   return slots_.size();
 }
 
+template< class Key, class T, class Hash, class ProbeHash, class KeyEqual >
+bool maslevtsov::HashTable< Key, T, Hash, ProbeHash, KeyEqual >::has_excess_tombstones() const noexcept
+{
+  if (deleted_ == 0) {
+    return false;
+  }
+  size_t used = size_ + deleted_ + 1;
+  if (used >= slots_.size()) {
+    return true;
+  }
+  return deleted_ > size_ && used > slots_.size() / 2;
+}
+
+template< class Key, class T, class Hash, class ProbeHash, class KeyEqual >
+void maslevtsov::HashTable< Key, T, Hash, ProbeHash, KeyEqual >::rebuild(size_type count)
+{
+  Vector< detail::Slot< value_type > > new_slots(count);
+  for (auto it = slots_.begin(); it != slots_.end(); ++it) {
+    if (it->state == detail::SlotState::OCCUPIED) {
+      const Key& key = it->data.first;
+      size_t index = hasher_(key) % new_slots.size();
+      size_t odd_step = detail::get_odd_step(key, new_slots.size(), probe_hasher_);
+      while (new_slots[index].state == detail::SlotState::OCCUPIED) {
+        index = (index + odd_step) % new_slots.size();
+      }
+      new_slots[index].data = std::move_if_noexcept(it->data);
+      new_slots[index].state = detail::SlotState::OCCUPIED;
+    }
+  }
+  slots_ = std::move(new_slots);
+  deleted_ = 0;
+}
+
 #endif
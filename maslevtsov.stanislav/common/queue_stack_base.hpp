@@ -1,6 +1,7 @@
 #ifndef QUEUE_STACK_BASE_HPP
 #define QUEUE_STACK_BASE_HPP
 
+#include <new>
 #include <utility>
 
 namespace maslevtsov {
@@ -31,6 +32,10 @@ namespace maslevtsov {
     T* data_;
     std::size_t size_, first_, capacity_;
 
+    static T* allocate(std::size_t capacity);
+    static void deallocate(T* data) noexcept;
+    std::size_t physical_index(std::size_t index) const noexcept;
+    void destroy_elements() noexcept;
     template< class U >
     void push_impl(U&& value);
     void expand_data(std::size_t new_capacity);
@@ -46,23 +51,18 @@ namespace maslevtsov {
 
   template< class T, bool is_pop_front >
   QueueStackBase< T, is_pop_front >::QueueStackBase(const QueueStackBase& rhs):
-    data_(new T[rhs.capacity_]),
-    size_(rhs.size_),
+    data_(allocate(rhs.capacity_)),
+    size_(0),
     first_(0),
     capacity_(rhs.capacity_)
   {
     try {
-      if (is_pop_front) {
-        for (std::size_t i = 0, j = rhs.first_; i != capacity_; ++i, j = (j + 1) % capacity_) {
-          data_[i] = rhs.data_[j];
-        }
-      } else {
-        for (std::size_t i = 0; i != capacity_; ++i) {
-          data_[i] = rhs.data_[i];
-        }
+      for (; size_ != rhs.size_; ++size_) {
+        new (data_ + size_) T(rhs[size_]);
       }
     } catch (...) {
-      delete[] data_;
+      destroy_elements();
+      deallocate(data_);
       throw;
     }
   }
@@ -78,7 +78,8 @@ namespace maslevtsov {
   template< class T, bool is_pop_front >
   QueueStackBase< T, is_pop_front >::~QueueStackBase()
   {
-    delete[] data_;
+    destroy_elements();
+    deallocate(data_);
   }
 
   template< class T, bool is_pop_front >
@@ -93,20 +94,20 @@ namespace maslevtsov {
   QueueStackBase< T, is_pop_front >& QueueStackBase< T, is_pop_front >::operator=(QueueStackBase&& rhs) noexcept
   {
     QueueStackBase< T, is_pop_front > moved(std::move(rhs));
-    swap(rhs);
+    swap(moved);
     return *this;
   }
 
   template< class T, bool is_pop_front >
   T& QueueStackBase< T, is_pop_front >::operator[](std::size_t index) noexcept
   {
-    return data_[is_pop_front ? ((first_ + index) % capacity_) : (size_ - 1)];
+    return data_[physical_index(index)];
   }
 
   template< class T, bool is_pop_front >
   const T& QueueStackBase< T, is_pop_front >::operator[](std::size_t index) const noexcept
   {
-    return data_[is_pop_front ? ((first_ + index) % capacity_) : (size_ - 1)];
+    return data_[physical_index(index)];
   }
 
   template< class T, bool is_pop_front >
@@ -137,7 +138,10 @@ namespace maslevtsov {
   void QueueStackBase< T, is_pop_front >::pop() noexcept
   {
     if (is_pop_front) {
+      data_[first_].~T();
       first_ = (first_ + 1) % capacity_;
+    } else {
+      data_[size_ - 1].~T();
     }
     --size_;
   }
@@ -151,35 +155,68 @@ namespace maslevtsov {
     std::swap(capacity_, other.capacity_);
   }
 
+  template< class T, bool is_pop_front >
+  T* QueueStackBase< T, is_pop_front >::allocate(std::size_t capacity)
+  {
+    return capacity == 0 ? nullptr : static_cast< T* >(::operator new(capacity * sizeof(T)));
+  }
+
+  template< class T, bool is_pop_front >
+  void QueueStackBase< T, is_pop_front >::deallocate(T* data) noexcept
+  {
+    ::operator delete(data);
+  }
+
+  template< class T, bool is_pop_front >
+  std::size_t QueueStackBase< T, is_pop_front >::physical_index(std::size_t index) const noexcept
+  {
+    if (!is_pop_front) {
+      return index;
+    }
+    std::size_t result = first_ + index;
+    return result < capacity_ ? result : result - capacity_;
+  }
+
+  template< class T, bool is_pop_front >
+  void QueueStackBase< T, is_pop_front >::destroy_elements() noexcept
+  {
+    for (std::size_t i = 0; i != size_; ++i) {
+      data_[physical_index(i)].~T();
+    }
+  }
+
   template< class T, bool is_pop_front >
   template< class U >
   void QueueStackBase< T, is_pop_front >::push_impl(U&& value)
   {
     if (size_ == capacity_) {
+      T pushed(std::forward< U >(value));
       expand_data(size_ * 2 + 1);
+      new (data_ + size_) T(std::move(pushed));
+    } else {
+      new (data_ + physical_index(size_)) T(std::forward< U >(value));
     }
-    data_[size_++] = std::forward< U >(value);
+    ++size_;
   }
 
   template< class T, bool is_pop_front >
   void QueueStackBase< T, is_pop_front >::expand_data(std::size_t new_capacity)
   {
-    T* new_data = new T[new_capacity];
+    T* new_data = allocate(new_capacity);
+    std::size_t moved = 0;
     try {
-      if (is_pop_front) {
-        for (std::size_t i = 0, j = first_; i != capacity_; ++i, j = (j + 1) % capacity_) {
-          new_data[i] = data_[j];
-        }
-      } else {
-        for (std::size_t i = 0; i != capacity_; ++i) {
-          new_data[i] = data_[i];
-        }
+      for (; moved != size_; ++moved) {
+        new (new_data + moved) T(std::move_if_noexcept(data_[physical_index(moved)]));
       }
     } catch (...) {
-      delete[] new_data;
+      for (std::size_t i = 0; i != moved; ++i) {
+        new_data[i].~T();
+      }
+      deallocate(new_data);
       throw;
     }
-    delete[] data_;
+    destroy_elements();
+    deallocate(data_);
     data_ = new_data;
     capacity_ = new_capacity;
     first_ = 0;
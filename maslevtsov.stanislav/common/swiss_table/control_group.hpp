@@ -0,0 +1,92 @@
+#ifndef SWISS_TABLE_CONTROL_GROUP_HPP
+#define SWISS_TABLE_CONTROL_GROUP_HPP
+
+#include <cstddef>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+namespace maslevtsov {
+  namespace detail {
+    using ctrl_t = signed char;
+
+    constexpr ctrl_t CTRL_EMPTY = -128;
+    constexpr ctrl_t CTRL_DELETED = -2;
+    constexpr size_t GROUP_WIDTH = 16;
+
+    inline bool is_full(ctrl_t ctrl) noexcept
+    {
+      return ctrl >= 0;
+    }
+
+    inline size_t lowest_bit_index(unsigned mask) noexcept
+    {
+#if defined(__GNUC__) || defined(__clang__)
+      return static_cast< size_t >(__builtin_ctz(mask));
+#else
+      size_t index = 0;
+      while ((mask & 1u) == 0) {
+        mask >>= 1;
+        ++index;
+      }
+      return index;
+#endif
+    }
+
+    class ControlGroup
+    {
+    public:
+      explicit ControlGroup(const ctrl_t* ctrl) noexcept:
+#ifdef __SSE2__
+        ctrl_(_mm_loadu_si128(reinterpret_cast< const __m128i* >(ctrl)))
+#else
+        ctrl_(ctrl)
+#endif
+      {}
+
+      unsigned match(ctrl_t h2) const noexcept
+      {
+#ifdef __SSE2__
+        return static_cast< unsigned >(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl_)));
+#else
+        unsigned mask = 0;
+        for (size_t i = 0; i != GROUP_WIDTH; ++i) {
+          if (ctrl_[i] == h2) {
+            mask |= 1u << i;
+          }
+        }
+        return mask;
+#endif
+      }
+
+      unsigned match_empty() const noexcept
+      {
+        return match(CTRL_EMPTY);
+      }
+
+      unsigned match_empty_or_deleted() const noexcept
+      {
+#ifdef __SSE2__
+        return static_cast< unsigned >(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(-1), ctrl_)));
+#else
+        unsigned mask = 0;
+        for (size_t i = 0; i != GROUP_WIDTH; ++i) {
+          if (ctrl_[i] < -1) {
+            mask |= 1u << i;
+          }
+        }
+        return mask;
+#endif
+      }
+
+    private:
+#ifdef __SSE2__
+      __m128i ctrl_;
+#else
+      const ctrl_t* ctrl_;
+#endif
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,85 @@
+#ifndef SWISS_TABLE_DECLARATION_HPP
+#define SWISS_TABLE_DECLARATION_HPP
+
+#include <functional>
+#include <initializer_list>
+#include <vector/declaration.hpp>
+#include "control_group.hpp"
+#include "swiss_table_iterator.hpp"
+
+namespace maslevtsov {
+  template< class Key, class T, class Hash = std::hash< Key >, class KeyEqual = std::equal_to< Key > >
+  class SwissTable
+  {
+  public:
+    using value_type = std::pair< Key, T >;
+    using size_type = std::size_t;
+    using iterator = SwissTableIterator< Key, T, Hash, KeyEqual, detail::SwissTableIteratorType::NONCONSTANT >;
+    using const_iterator = SwissTableIterator< Key, T, Hash, KeyEqual, detail::SwissTableIteratorType::CONSTANT >;
+
+    SwissTable();
+    SwissTable(const SwissTable& rhs);
+    SwissTable(SwissTable&& rhs) noexcept;
+    template< class InputIt >
+    SwissTable(InputIt first, InputIt last);
+    SwissTable(std::initializer_list< value_type > ilist);
+    ~SwissTable();
+
+    SwissTable& operator=(const SwissTable& rhs);
+    SwissTable& operator=(SwissTable&& rhs) noexcept;
+
+    T& operator[](const Key& key);
+    const T& operator[](const Key& key) const;
+    T& at(const Key& key);
+    const T& at(const Key& key) const;
+    iterator find(const Key& key) noexcept;
+    const_iterator find(const Key& key) const noexcept;
+
+    iterator begin() noexcept;
+    const_iterator begin() const noexcept;
+    const_iterator cbegin() const noexcept;
+    iterator end() noexcept;
+    const_iterator end() const noexcept;
+    const_iterator cend() const noexcept;
+
+    bool empty() const noexcept;
+    size_type size() const noexcept;
+
+    void clear() noexcept;
+    std::pair< iterator, bool > insert(const value_type& value);
+    template< class InputIt >
+    void insert(InputIt first, InputIt last);
+    template< class... Args >
+    std::pair< iterator, bool > emplace(Args&&... args);
+    iterator erase(iterator pos) noexcept;
+    iterator erase(const_iterator pos) noexcept;
+    size_type erase(const Key& key) noexcept;
+    void swap(SwissTable& other) noexcept;
+
+    float load_factor() const noexcept;
+    void rehash(size_type count);
+
+  private:
+    friend class SwissTableIterator< Key, T, Hash, KeyEqual, detail::SwissTableIteratorType::CONSTANT >;
+    friend class SwissTableIterator< Key, T, Hash, KeyEqual, detail::SwissTableIteratorType::NONCONSTANT >;
+
+    Vector< detail::ctrl_t > ctrl_;
+    value_type* values_;
+    size_type size_;
+    size_type deleted_;
+    Hash hasher_;
+    KeyEqual key_equal_;
+
+    explicit SwissTable(size_type count);
+
+    static value_type* allocate(size_type count);
+    static void deallocate(value_type* values) noexcept;
+    size_t get_hash(const Key& key) const noexcept;
+    void destroy_elements() noexcept;
+    size_type find_index(const Key& key, size_t hash) const noexcept;
+    size_type find_free_index(size_t hash) const noexcept;
+    void rebuild(size_type count);
+  };
+}
+
+#endif
@@ -0,0 +1,436 @@
+#ifndef SWISS_TABLE_DEFINITION_HPP
+#define SWISS_TABLE_DEFINITION_HPP
+
+#include <new>
+#include <stdexcept>
+#include <utility>
+#include <vector/definition.hpp>
+#include "declaration.hpp"
+
+namespace maslevtsov {
+  namespace detail {
+    inline size_t mix_hash(size_t hash) noexcept
+    {
+      hash ^= hash >> 33;
+      hash *= 0xff51afd7ed558ccdULL;
+      hash ^= hash >> 33;
+      hash *= 0xc4ceb9fe1a85ec53ULL;
+      hash ^= hash >> 33;
+      return hash;
+    }
+
+    inline size_t get_h1(size_t hash) noexcept
+    {
+      return hash >> 7;
+    }
+
+    inline ctrl_t get_h2(size_t hash) noexcept
+    {
+      return static_cast< ctrl_t >(hash & 0x7F);
+    }
+
+    inline Vector< ctrl_t > make_empty_ctrl(size_t count)
+    {
+      Vector< ctrl_t > ctrl(count);
+      for (size_t i = 0; i != count; ++i) {
+        ctrl[i] = CTRL_EMPTY;
+      }
+      return ctrl;
+    }
+  }
+}
+
+template< class Key, class T, class Hash, class KeyEqual >
+maslevtsov::SwissTable< Key, T, Hash, KeyEqual >::SwissTable():
+  SwissTable(detail::GROUP_WIDTH)
+{}
+
+template< class Key, class T, class Hash, class KeyEqual >
+maslevtsov::SwissTable< Key, T, Hash, KeyEqual >::SwissTable(const SwissTable& rhs):
+  SwissTable(rhs.ctrl_.size())
+{
+  hasher_ = rhs.hasher_;
+  key_equal_ = rhs.key_equal_;
+  for (size_t i = 0; i != rhs.ctrl_.size(); ++i) {
+    if (detail::is_full(rhs.ctrl_[i])) {
+      new (values_ + i) value_type(rhs.values_[i]);
+      ctrl_[i] = rhs.ctrl_[i];
+    } else if (rhs.ctrl_[i] == detail::CTRL_DELETED) {
+      ctrl_[i] = detail::CTRL_DELETED;
+    }
+  }
+  size_ = rhs.size_;
+  deleted_ = rhs.deleted_;
+}
+
+template< class Key, class T, class Hash, class KeyEqual >
+maslevtsov::SwissTable< Key, T, Hash, KeyEqual >::SwissTable(SwissTable&& rhs) noexcept:
+  ctrl_(std::move(rhs.ctrl_)),
+  values_(std::exchange(rhs.values_, nullptr)),
+  size_(std::exchange(rhs.size_, 0)),
+  deleted_(std::exchange(rhs.deleted_, 0)),
+  hasher_(std::move(rhs.hasher_)),
+  key_equal_(std::move(rhs.key_equal_))
+{}
+
+template< class Key, class T, class Hash, class KeyEqual >
+maslevtsov::SwissTable< Key, T, Hash, KeyEqual >::SwissTable(size_type count):
+  ctrl_(detail::make_empty_ctrl(count)),
+  values_(allocate(count)),
+  size_(0),
+  deleted_(0),
+  hasher_(),
+  key_equal_()
+{}
+
+template< class Key, class T, class Hash, class KeyEqual >
+template< class InputIt >
+maslevtsov::SwissTable< Key, T, Hash, KeyEqual >::SwissTable(InputIt first, InputIt last):
+  SwissTable()
+{
+  insert(first, last);
+}
+
+template< class Key, class T, class Hash, class KeyEqual >
+maslevtsov::SwissTable< Key, T, Hash, KeyEqual >::SwissTable(std::initializer_list< value_type > ilist):
+  SwissTable(ilist.begin(), ilist.end())
+{}
+
+template< class Key, class T, class Hash, class KeyEqual >
+maslevtsov::SwissTable< Key, T, Hash, KeyEqual >::~SwissTable()
+{
+  destroy_elements();
+  deallocate(values_);
+}
+
+template< class Key, class T, class Hash, class KeyEqual >
+maslevtsov::SwissTable< Key, T, Hash, KeyEqual >&
+  maslevtsov::SwissTable< Key, T, Hash, KeyEqual >::operator=(const SwissTable& rhs)
+{
+  SwissTable< Key, T, Hash, KeyEqual > copied(rhs);
+  swap(copied);
+  return *this;
+}
+
+template< class Key, class T, class Hash, class KeyEqual >
+maslevtsov::SwissTable< Key, T, Hash, KeyEqual >&
+  maslevtsov::SwissTable< Key, T, Hash, KeyEqual >::operator=(SwissTable&& rhs) noexcept
+{
+  SwissTable< Key, T, Hash, KeyEqual > moved(std::move(rhs));
+  swap(moved);
+  return *this;
+}
+
+template< class Key, class T, class Hash, class KeyEqual >
+T& maslevtsov::SwissTable< Key, T, Hash, KeyEqual >::operator[](const Key& key)
+{
+  iterator it = find(key);
+  if (it != end()) {
+    return it->second;
+  }
+  return emplace(key, T()).first->second;
+}
+
+template< class Key, class T, class Hash, class KeyEqual >
+const T& maslevtsov::SwissTable< Key, T, Hash, KeyEqual >::operator[](const Key& key) const
+{
+  return at(key);
+}
+
+template< class Key, class T, class Hash, class KeyEqual >
+T& maslevtsov::SwissTable< Key, T, Hash, KeyEqual >::at(const Key& key)
+{
+  iterator it = find(key);
+  if (it != end()) {
+    return it->second;
+  }
+  throw std::out_of_range("invalid key");
+}
+
+template< class Key, class T, class Hash, class KeyEqual >
+const T& maslevtsov::SwissTable< Key, T, Hash, KeyEqual >::at(const Key& key) const
+{
+  const_iterator it = find(key);
+  if (it != cend()) {
+    return it->second;
+  }
+  throw std::out_of_range("invalid key");
+}
+
+template< class Key, class T, class Hash, class KeyEqual >
+typename maslevtsov::SwissTable< Key, T, Hash, KeyEqual >::iterator
+  maslevtsov::SwissTable< Key, T, Hash, KeyEqual >::find(const Key& key) noexcept
+{
+  return iterator(this, find_index(key, get_hash(key)));
+}
+
+template< class Key, class T, class Hash, class KeyEqual >
+typename maslevtsov::SwissTable< Key, T, Hash, KeyEqual >::const_iterator
+  maslevtsov::SwissTable< Key, T, Hash, KeyEqual >::find(const Key& key) const noexcept
+{
+  return const_iterator(this, find_index(key, get_hash(key)));
+}
+
+template< class Key, class T, class Hash, class KeyEqual >
+typename maslevtsov::SwissTable< Key, T, Hash, KeyEqual >::iterator
+  maslevtsov::SwissTable< Key, T, Hash, KeyEqual >::begin() noexcept
+{
+  return detail::is_full(ctrl_[0]) ? iterator(this, 0) : ++iterator(this, 0);
+}
+
+template< class Key, class T, class Hash, class KeyEqual >
+typename maslevtsov::SwissTable< Key, T, Hash, KeyEqual >::const_iterator
+  maslevtsov::SwissTable< Key, T, Hash, KeyEqual >::begin() const noexcept
+{
+  return cbegin();
+}
+
+template< class Key, class T, class Hash, class KeyEqual >
+typename maslevtsov::SwissTable< Key, T, Hash, KeyEqual >::const_iterator
+  maslevtsov::SwissTable< Key, T, Hash, KeyEqual >::cbegin() const noexcept
+{
+  return detail::is_full(ctrl_[0]) ? const_iterator(this, 0) : ++const_iterator(this, 0);
+}
+
+template< class Key, class T, class Hash, class KeyEqual >
+typename maslevtsov::SwissTable< Key, T, Hash, KeyEqual >::iterator
+  maslevtsov::SwissTable< Key, T, Hash, KeyEqual >::end() noexcept
+{
+  return iterator(this, ctrl_.size());
+}
+
+template< class Key, class T, class Hash, class KeyEqual >
+typename maslevtsov::SwissTable< Key, T, Hash, KeyEqual >::const_iterator
+  maslevtsov::SwissTable< Key, T, Hash, KeyEqual >::end() const noexcept
+{
+  return cend();
+}
+
+template< class Key, class T, class Hash, class KeyEqual >
+typename maslevtsov::SwissTable< Key, T, Hash, KeyEqual >::const_iterator
+  maslevtsov::SwissTable< Key, T, Hash, KeyEqual >::cend() const noexcept
+{
+  return const_iterator(this, ctrl_.size());
+}
+
+template< class Key, class T, class Hash, class KeyEqual >
+bool maslevtsov::SwissTable< Key, T, Hash, KeyEqual >::empty() const noexcept
+{
+  return size_ == 0;
+}
+
+template< class Key, class T, class Hash, class KeyEqual >
+typename maslevtsov::SwissTable< Key, T, Hash, KeyEqual >::size_type
+  maslevtsov::SwissTable< Key, T, Hash, KeyEqual >::size() const noexcept
+{
+  return size_;
+}
+
+template< class Key, class T, class Hash, class KeyEqual >
+void maslevtsov::SwissTable< Key, T, Hash, KeyEqual >::clear() noexcept
+{
+  destroy_elements();
+  for (size_t i = 0; i != ctrl_.size(); ++i) {
+    ctrl_[i] = detail::CTRL_EMPTY;
+  }
+  size_ = 0;
+  deleted_ = 0;
+}
+
+template< class Key, class T, class Hash, class KeyEqual >
+std::pair< typename maslevtsov::SwissTable< Key, T, Hash, KeyEqual >::iterator, bool >
+  maslevtsov::SwissTable< Key, T, Hash, KeyEqual >::insert(const value_type& value)
+{
+  return emplace(value);
+}
+
+template< class Key, class T, class Hash, class KeyEqual >
+template< class InputIt >
+void maslevtsov::SwissTable< Key, T, Hash, KeyEqual >::insert(InputIt first, InputIt last)
+{
+  for (; first != last; ++first) {
+    insert(*first);
+  }
+}
+
+template< class Key, class T, class Hash, class KeyEqual >
+template< class... Args >
+std::pair< typename maslevtsov::SwissTable< Key, T, Hash, KeyEqual >::iterator, bool >
+  maslevtsov::SwissTable< Key, T, Hash, KeyEqual >::emplace(Args&&... args)
+{
+  value_type value(std::forward< Args >(args)...);
+  size_t hash = get_hash(value.first);
+  size_t index = find_index(value.first, hash);
+  if (index != ctrl_.size()) {
+    return {iterator(this, index), false};
+  }
+  if ((size_ + deleted_ + 1) * 8 > ctrl_.size() * 7) {
+    if ((size_ + 1) * 16 <= ctrl_.size() * 7) {
+      rebuild(ctrl_.size());
+    } else {
+      rebuild(ctrl_.size() * 2);
+    }
+  }
+  index = find_free_index(hash);
+  if (ctrl_[index] == detail::CTRL_DELETED) {
+    --deleted_;
+  }
+  new (values_ + index) value_type(std::move(value));
+  ctrl_[index] = detail::get_h2(hash);
+  ++size_;
+  return {iterator(this, index), true};
+}
+
+template< class Key, class T, class Hash, class KeyEqual >
+typename maslevtsov::SwissTable< Key, T, Hash, KeyEqual >::iterator
+  maslevtsov::SwissTable< Key, T, Hash, KeyEqual >::erase(iterator pos) noexcept
+{
+  values_[pos.index_].~value_type();
+  size_t group_start = pos.index_ - pos.index_ % detail::GROUP_WIDTH;
+  if (detail::ControlGroup(&ctrl_[group_start]).match_empty() != 0) {
+    ctrl_[pos.index_] = detail::CTRL_EMPTY;
+  } else {
+    ctrl_[pos.index_] = detail::CTRL_DELETED;
+    ++deleted_;
+  }
+  --size_;
+  return ++pos;
+}
+
+template< class Key, class T, class Hash, class KeyEqual >
+typename maslevtsov::SwissTable< Key, T, Hash, KeyEqual >::iterator
+  maslevtsov::SwissTable< Key, T, Hash, KeyEqual >::erase(const_iterator pos) noexcept
+{
+  return erase(iterator(this, pos.index_));
+}
+
+template< class Key, class T, class Hash, class KeyEqual >
+typename maslevtsov::SwissTable< Key, T, Hash, KeyEqual >::size_type
+  maslevtsov::SwissTable< Key, T, Hash, KeyEqual >::erase(const Key& key) noexcept
+{
+  iterator it = find(key);
+  if (it == end()) {
+    return 0;
+  }
+  erase(it);
+  return 1;
+}
+
+template< class Key, class T, class Hash, class KeyEqual >
+void maslevtsov::SwissTable< Key, T, Hash, KeyEqual >::swap(SwissTable& other) noexcept
+{
+  std::swap(ctrl_, other.ctrl_);
+  std::swap(values_, other.values_);
+  std::swap(size_, other.size_);
+  std::swap(deleted_, other.deleted_);
+  std::swap(hasher_, other.hasher_);
+  std::swap(key_equal_, other.key_equal_);
+}
+
+template< class Key, class T, class Hash, class KeyEqual >
+float maslevtsov::SwissTable< Key, T, Hash, KeyEqual >::load_factor() const noexcept
+{
+  return static_cast< float >(size_) / ctrl_.size();
+}
+
+template< class Key, class T, class Hash, class KeyEqual >
+void maslevtsov::SwissTable< Key, T, Hash, KeyEqual >::rehash(size_type count)
+{
+  if (count <= ctrl_.size()) {
+    return;
+  }
+  size_t new_count = detail::GROUP_WIDTH;
+  while (new_count < count) {
+    new_count *= 2;
+  }
+  rebuild(new_count);
+}
+
+template< class Key, class T, class Hash, class KeyEqual >
+typename maslevtsov::SwissTable< Key, T, Hash, KeyEqual >::value_type*
+  maslevtsov::SwissTable< Key, T, Hash, KeyEqual >::allocate(size_type count)
+{
+  return static_cast< value_type* >(::operator new(count * sizeof(value_type)));
+}
+
+template< class Key, class T, class Hash, class KeyEqual >
+void maslevtsov::SwissTable< Key, T, Hash, KeyEqual >::deallocate(value_type* values) noexcept
+{
+  ::operator delete(values);
+}
+
+template< class Key, class T, class Hash, class KeyEqual >
+size_t maslevtsov::SwissTable< Key, T, Hash, KeyEqual >::get_hash(const Key& key) const noexcept
+{
+  return detail::mix_hash(hasher_(key));
+}
+
+template< class Key, class T, class Hash, class KeyEqual >
+void maslevtsov::SwissTable< Key, T, Hash, KeyEqual >::destroy_elements() noexcept
+{
+  for (size_t i = 0; i != ctrl_.size(); ++i) {
+    if (detail::is_full(ctrl_[i])) {
+      values_[i].~value_type();
+    }
+  }
+}
+
+template< class Key, class T, class Hash, class KeyEqual >
+typename maslevtsov::SwissTable< Key, T, Hash, KeyEqual >::size_type
+  maslevtsov::SwissTable< Key, T, Hash, KeyEqual >::find_index(const Key& key, size_t hash) const noexcept
+{
+  size_t group_mask = ctrl_.size() / detail::GROUP_WIDTH - 1;
+  size_t group = detail::get_h1(hash) & group_mask;
+  detail::ctrl_t h2 = detail::get_h2(hash);
+  for (size_t i = 0; i <= group_mask; ++i) {
+    size_t group_start = group * detail::GROUP_WIDTH;
+    detail::ControlGroup control_group(&ctrl_[group_start]);
+    for (unsigned mask = control_group.match(h2); mask != 0; mask &= mask - 1) {
+      size_t index = group_start + detail::lowest_bit_index(mask);
+      if (key_equal_(values_[index].first, key)) {
+        return index;
+      }
+    }
+    if (control_group.match_empty() != 0) {
+      return ctrl_.size();
+    }
+    group = (group + i + 1) & group_mask;
+  }
+  return ctrl_.size();
+}
+
+template< class Key, class T, class Hash, class KeyEqual >
+typename maslevtsov::SwissTable< Key, T, Hash, KeyEqual >::size_type
+  maslevtsov::SwissTable< Key, T, Hash, KeyEqual >::find_free_index(size_t hash) const noexcept
+{
+  size_t group_mask = ctrl_.size() / detail::GROUP_WIDTH - 1;
+  size_t group = detail::get_h1(hash) & group_mask;
+  for (size_t i = 0; i <= group_mask; ++i) {
+    size_t group_start = group * detail::GROUP_WIDTH;
+    unsigned mask = detail::ControlGroup(&ctrl_[group_start]).match_empty_or_deleted();
+    if (mask != 0) {
+      return group_start + detail::lowest_bit_index(mask);
+    }
+    group = (group + i + 1) & group_mask;
+  }
+  return ctrl_.size();
+}
+
+template< class Key, class T, class Hash, class KeyEqual >
+void maslevtsov::SwissTable< Key, T, Hash, KeyEqual >::rebuild(size_type count)
+{
+  SwissTable< Key, T, Hash, KeyEqual > new_table(count);
+  new_table.hasher_ = hasher_;
+  new_table.key_equal_ = key_equal_;
+  for (size_t i = 0; i != ctrl_.size(); ++i) {
+    if (detail::is_full(ctrl_[i])) {
+      size_t index = new_table.find_free_index(get_hash(values_[i].first));
+      new (new_table.values_ + index) value_type(std::move_if_noexcept(values_[i]));
+      new_table.ctrl_[index] = ctrl_[i];
+    }
+  }
+  new_table.size_ = size_;
+  swap(new_table);
+}
+
+#endif
@@ -0,0 +1,94 @@
+#ifndef SWISS_TABLE_ITERATOR_HPP
+#define SWISS_TABLE_ITERATOR_HPP
+
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include "control_group.hpp"
+
+namespace maslevtsov {
+  namespace detail {
+    enum class SwissTableIteratorType
+    {
+      CONSTANT,
+      NONCONSTANT,
+    };
+  }
+
+  template< class Key, class T, class Hash, class KeyEqual >
+  class SwissTable;
+
+  template< class Key, class T, class Hash, class KeyEqual, detail::SwissTableIteratorType it_type >
+  class SwissTableIterator final: public std::iterator< std::forward_iterator_tag, T >
+  {
+  public:
+    using value_type = std::pair< Key, T >;
+    using reference_type = typename std::conditional< it_type == detail::SwissTableIteratorType::CONSTANT,
+      const value_type&, value_type& >::type;
+    using pointer_type = typename std::conditional< it_type == detail::SwissTableIteratorType::CONSTANT,
+      const value_type*, value_type* >::type;
+
+    SwissTableIterator() noexcept:
+      table_(nullptr),
+      index_(0)
+    {}
+
+    SwissTableIterator& operator++() noexcept
+    {
+      ++index_;
+      skip_free();
+      return *this;
+    }
+
+    SwissTableIterator operator++(int) noexcept
+    {
+      SwissTableIterator< Key, T, Hash, KeyEqual, it_type > result(*this);
+      ++(*this);
+      return result;
+    }
+
+    reference_type operator*() const noexcept
+    {
+      return table_->values_[index_];
+    }
+
+    pointer_type operator->() const noexcept
+    {
+      return std::addressof(table_->values_[index_]);
+    }
+
+    bool operator==(const SwissTableIterator& rhs) const noexcept
+    {
+      return table_ == rhs.table_ && index_ == rhs.index_;
+    }
+
+    bool operator!=(const SwissTableIterator& rhs) const noexcept
+    {
+      return !(*this == rhs);
+    }
+
+  private:
+    friend class SwissTable< Key, T, Hash, KeyEqual >;
+
+    using table_type = typename std::conditional< it_type == detail::SwissTableIteratorType::CONSTANT,
+      const SwissTable< Key, T, Hash, KeyEqual >, SwissTable< Key, T, Hash, KeyEqual > >::type;
+
+    table_type* table_;
+    size_t index_;
+
+    SwissTableIterator(table_type* table, size_t index) noexcept:
+      table_(table),
+      index_(index)
+    {}
+
+    void skip_free() noexcept
+    {
+      size_t ctrl_size = table_->ctrl_.size();
+      while (index_ < ctrl_size && !detail::is_full(table_->ctrl_[index_])) {
+        ++index_;
+      }
+    }
+  };
+}
+
+#endif
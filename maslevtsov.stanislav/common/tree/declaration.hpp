@@ -5,6 +5,10 @@
 #include "tree_iterator.hpp"
 
 namespace maslevtsov {
+  struct sorted_unique_t
+  {};
+  constexpr sorted_unique_t sorted_unique{};
+
   template< class Key, class T, class Compare = std::less< Key > >
   class Tree
   {
@@ -17,6 +21,10 @@ namespace maslevtsov {
     Tree();
     Tree(const Tree& rhs);
     Tree(Tree&& rhs) noexcept;
+    template< class InputIt >
+    Tree(InputIt first, InputIt last);
+    template< class InputIt >
+    Tree(sorted_unique_t, InputIt first, InputIt last);
     ~Tree();
 
     Tree& operator=(const Tree& rhs);
@@ -63,6 +71,11 @@ namespace maslevtsov {
     std::pair< iterator, iterator > equal_range(const Key& key);
     std::pair< const_iterator, const_iterator > equal_range(const Key& key) const;
 
+    iterator nth(size_type index) noexcept;
+    const_iterator nth(size_type index) const noexcept;
+    size_type rank(const Key& key) const noexcept;
+    size_type count_range(const Key& lo, const Key& hi) const noexcept;
+
   private:
     using Node = TreeNode< value_type >;
 
@@ -70,17 +83,24 @@ namespace maslevtsov {
     size_type size_;
     Compare compare_;
 
-    void split_nodes(Node* node, value_type& to_insert, Node* left_child = nullptr, Node* right_child = nullptr);
+    Node* create_node();
+    void split_nodes(Node* node, value_type& to_insert, Node* spare, Node* left_child = nullptr,
+      Node* right_child = nullptr) noexcept;
     void clear_subtree(Node* node) noexcept;
+    template< class InputIt >
+    void build_sorted(InputIt first, size_type count);
+    template< class InputIt >
+    Node* build_subtree(InputIt& first, size_type count, size_type height);
     void assign_value(value_type& dist, const value_type& src);
+    void update_sizes(Node* node) noexcept;
 
     void erase_from_leaf(iterator pos) noexcept;
-    void balance_parent_three(Node* deleted) noexcept;
-    void balance_parent_two(Node* deleted) noexcept;
-    void balance_parent_bro_two(Node* deleted) noexcept;
-    void balance_next_parent_three(Node* deleted, Node* next_parent) noexcept;
-    bool balance_next_parent_two(Node* deleted, Node* next_parent) noexcept;
+    void balance_hole(Node* hole) noexcept;
+    void rotate_from_left(Node* hole, Node* sibling, value_type& separator) noexcept;
+    void rotate_from_right(Node* hole, Node* sibling, value_type& separator) noexcept;
+    void merge_into_sibling(Node* hole, size_t hole_index, Node* sibling, value_type& separator) noexcept;
 
+    size_type count_less(const Key& key, bool is_inclusive) const noexcept;
     std::pair< iterator, bool > find_impl(const Key& key) const noexcept;
   };
 }
@@ -5,9 +5,49 @@
 #include <utility>
 #include <queue.hpp>
 
+namespace maslevtsov {
+  namespace detail {
+    template< class T >
+    std::size_t get_size(const TreeNode< T >* node) noexcept
+    {
+      return node ? node->size : 0;
+    }
+
+    template< class T >
+    void recount(TreeNode< T >* node) noexcept
+    {
+      node->size = (node->is_two ? 1 : 2) + get_size(node->left) + get_size(node->middle) + get_size(node->right);
+    }
+
+    template< class T >
+    std::size_t get_child_index(const TreeNode< T >* parent, const TreeNode< T >* child) noexcept
+    {
+      if (parent->left == child) {
+        return 0;
+      }
+      if (!parent->is_two && parent->middle == child) {
+        return 1;
+      }
+      return parent->is_two ? 1 : 2;
+    }
+
+    template< class T >
+    TreeNode< T >* get_child(TreeNode< T >* parent, std::size_t index) noexcept
+    {
+      if (index == 0) {
+        return parent->left;
+      }
+      if (index == 1 && !parent->is_two) {
+        return parent->middle;
+      }
+      return parent->right;
+    }
+  }
+}
+
 template< class Key, class T, class Compare >
 maslevtsov::Tree< Key, T, Compare >::Tree():
-  dummy_root_(new Node{nullptr, nullptr, nullptr, nullptr, true, value_type(), value_type()}),
+  dummy_root_(new Node{nullptr, nullptr, nullptr, nullptr, true, value_type(), value_type(), 0}),
   size_(0),
   compare_(Compare())
 {}
@@ -16,9 +56,7 @@ template< class Key, class T, class Compare >
 maslevtsov::Tree< Key, T, Compare >::Tree(const Tree& rhs):
   Tree()
 {
-  for (auto it = rhs.cbegin(); it != rhs.cend(); ++it) {
-    insert(std::make_pair(it->first, it->second));
-  }
+  build_sorted(rhs.cbegin(), rhs.size_);
 }
 
 template< class Key, class T, class Compare >
@@ -27,6 +65,42 @@ maslevtsov::Tree< Key, T, Compare >::Tree(Tree&& rhs) noexcept:
   size_(std::exchange(rhs.size_, 0))
 {}
 
+template< class Key, class T, class Compare >
+template< class InputIt >
+maslevtsov::Tree< Key, T, Compare >::Tree(InputIt first, InputIt last):
+  Tree()
+{
+  size_type count = 0;
+  InputIt it = first;
+  if (it != last) {
+    InputIt prev = it;
+    for (++it, ++count; it != last; ++it, ++prev, ++count) {
+      if (!compare_(prev->first, it->first)) {
+        break;
+      }
+    }
+  }
+  if (it == last) {
+    build_sorted(first, count);
+    return;
+  }
+  for (; first != last; ++first) {
+    insert(*first);
+  }
+}
+
+template< class Key, class T, class Compare >
+template< class InputIt >
+maslevtsov::Tree< Key, T, Compare >::Tree(sorted_unique_t, InputIt first, InputIt last):
+  Tree()
+{
+  size_type count = 0;
+  for (InputIt it = first; it != last; ++it) {
+    ++count;
+  }
+  build_sorted(first, count);
+}
+
 template< class Key, class T, class Compare >
 maslevtsov::Tree< Key, T, Compare >::~Tree()
 {
@@ -230,24 +304,9 @@ typename maslevtsov::Tree< Key, T, Compare >::size_type maslevtsov::Tree< Key, T
 template< class Key, class T, class Compare >
 void maslevtsov::Tree< Key, T, Compare >::clear() noexcept
 {
-  Node* current = iterator::get_min_node(dummy_root_);
-  while (current && !empty()) {
-    Node* cur_parent = current->parent;
-    Node* next = nullptr;
-    if (cur_parent->left == current) {
-      if (cur_parent->middle) {
-        next = cur_parent->middle;
-      } else {
-        next = cur_parent->right;
-      }
-      next = iterator::get_min_node(next);
-    } else if (cur_parent->middle == current) {
-      next = iterator::get_min_node(cur_parent->right);
-    } else {
-      next = cur_parent;
-    }
-    delete current;
-    current = next;
+  if (dummy_root_) {
+    clear_subtree(dummy_root_->left);
+    dummy_root_->left = nullptr;
   }
   size_ = 0;
 }
@@ -257,7 +316,14 @@ std::pair< typename maslevtsov::Tree< Key, T, Compare >::iterator, bool >
   maslevtsov::Tree< Key, T, Compare >::insert(const value_type& value)
 {
   if (empty()) {
-    Node* new_node = new Node{dummy_root_, nullptr, nullptr, nullptr, true, value, value_type()};
+    Node* new_node = create_node();
+    try {
+      assign_value(new_node->data1, value);
+    } catch (...) {
+      delete new_node;
+      throw;
+    }
+    new_node->parent = dummy_root_;
     dummy_root_->left = new_node;
     ++size_;
     return {iterator(new_node, true), true};
@@ -267,38 +333,53 @@ std::pair< typename maslevtsov::Tree< Key, T, Compare >::iterator, bool >
     return result;
   }
   Node* current = dummy_root_->left;
-  while (current->left || current->middle || (!current->is_two && current->right)) {
-    if (current->is_two) {
-      if (compare_(value.first, current->data1.first)) {
-        current = current->left;
-      } else {
-        current = current->right;
-      }
+  while (current->left) {
+    if (compare_(value.first, current->data1.first)) {
+      current = current->left;
+    } else if (!current->is_two && compare_(value.first, current->data2.first)) {
+      current = current->middle;
     } else {
-      if (compare_(value.first, current->data1.first)) {
-        current = current->left;
-      } else if (compare_(value.first, current->data2.first)) {
-        current = current->middle;
-      } else {
-        current = current->right;
-      }
+      current = current->right;
     }
   }
+  value_type to_insert(value);
   if (current->is_two) {
-    if (compare_(value.first, current->data1.first)) {
-      assign_value(current->data2, current->data1);
-      assign_value(current->data1, value);
-      current->is_two = false;
-      ++size_;
-      return {iterator(current, true), true};
+    if (compare_(to_insert.first, current->data1.first)) {
+      std::swap(current->data2, current->data1);
+      std::swap(current->data1, to_insert);
+    } else {
+      std::swap(current->data2, to_insert);
     }
-    assign_value(current->data2, value);
     current->is_two = false;
+    update_sizes(current);
     ++size_;
-    return {iterator(current, false), true};
+    return find_impl(value.first);
   }
-  value_type to_insert(value);
-  split_nodes(current, to_insert);
+  size_t spare_count = 0;
+  Node* full = current;
+  while (full != dummy_root_ && !full->is_two) {
+    ++spare_count;
+    full = full->parent;
+  }
+  if (full == dummy_root_) {
+    ++spare_count;
+  }
+  Node* spare = nullptr;
+  try {
+    for (size_t i = 0; i != spare_count; ++i) {
+      Node* new_node = create_node();
+      new_node->parent = spare;
+      spare = new_node;
+    }
+  } catch (...) {
+    while (spare) {
+      Node* next = spare->parent;
+      delete spare;
+      spare = next;
+    }
+    throw;
+  }
+  split_nodes(current, to_insert, spare);
   ++size_;
   return find_impl(value.first);
 }
@@ -309,12 +390,6 @@ typename maslevtsov::Tree< Key, T, Compare >::iterator maslevtsov::Tree< Key, T,
   if (pos == end()) {
     return end();
   }
-  if (size_ == 1) {
-    delete dummy_root_->left;
-    dummy_root_->left = nullptr;
-    --size_;
-    return end();
-  }
   iterator after_removed = pos;
   Key next_key = (++after_removed)->first;
   if (pos.node_->left) {
@@ -420,114 +495,134 @@ std::pair< typename maslevtsov::Tree< Key, T, Compare >::const_iterator,
 }
 
 template< class Key, class T, class Compare >
-void maslevtsov::Tree< Key, T, Compare >::split_nodes(Node* node, value_type& to_insert, Node* left_child,
-  Node* right_child)
+typename maslevtsov::Tree< Key, T, Compare >::iterator
+  maslevtsov::Tree< Key, T, Compare >::nth(size_type index) noexcept
 {
-  value_type values_to_split[3] = {node->data1, node->data2, to_insert};
-  if (compare_(values_to_split[2].first, values_to_split[0].first)) {
-    std::swap(values_to_split[2], values_to_split[0]);
-  }
-  if (compare_(values_to_split[1].first, values_to_split[0].first)) {
-    std::swap(values_to_split[1], values_to_split[0]);
-  }
-  if (compare_(values_to_split[2].first, values_to_split[1].first)) {
-    std::swap(values_to_split[2], values_to_split[1]);
-  }
-  Node* left_node = new Node{nullptr, nullptr, nullptr, nullptr, true, values_to_split[0], value_type()};
-  Node* right_node = nullptr;
-  try {
-    right_node = new Node{nullptr, nullptr, nullptr, nullptr, true, values_to_split[2], value_type()};
-  } catch (...) {
-    delete left_node;
-    clear_subtree(left_child);
-    clear_subtree(right_child);
-    throw;
+  const_iterator it = static_cast< const Tree< Key, T, Compare >& >(*this).nth(index);
+  return iterator(it.node_, it.is_first_);
+}
+
+template< class Key, class T, class Compare >
+typename maslevtsov::Tree< Key, T, Compare >::const_iterator
+  maslevtsov::Tree< Key, T, Compare >::nth(size_type index) const noexcept
+{
+  if (index >= size_) {
+    return cend();
   }
-  if (node->left) {
-    Node* kids[4] = {node->left, node->middle, node->right, nullptr};
-    if (compare_(to_insert.first, node->data1.first)) {
-      kids[3] = kids[2];
-      kids[2] = kids[1];
-      kids[0] = left_child;
-      kids[1] = right_child;
-    } else if (compare_(node->data2.first, to_insert.first)) {
-      kids[3] = right_child;
-      kids[2] = left_child;
-    } else {
-      kids[3] = kids[2];
-      kids[2] = right_child;
-      kids[1] = left_child;
-    }
-    left_node->left = kids[0];
-    if (kids[0]) {
-      kids[0]->parent = left_node;
+  Node* current = dummy_root_->left;
+  while (true) {
+    size_t left_size = detail::get_size(current->left);
+    if (index < left_size) {
+      current = current->left;
+      continue;
     }
-    left_node->right = kids[1];
-    if (kids[1]) {
-      kids[1]->parent = left_node;
+    if (index == left_size) {
+      return const_iterator(current, true);
     }
-    right_node->left = kids[2];
-    if (kids[2]) {
-      kids[2]->parent = right_node;
+    index -= left_size + 1;
+    if (!current->is_two) {
+      size_t middle_size = detail::get_size(current->middle);
+      if (index < middle_size) {
+        current = current->middle;
+        continue;
+      }
+      if (index == middle_size) {
+        return const_iterator(current, false);
+      }
+      index -= middle_size + 1;
     }
-    right_node->right = kids[3];
-    if (kids[3]) {
-      kids[3]->parent = right_node;
+    current = current->right;
+  }
+}
+
+template< class Key, class T, class Compare >
+typename maslevtsov::Tree< Key, T, Compare >::size_type
+  maslevtsov::Tree< Key, T, Compare >::rank(const Key& key) const noexcept
+{
+  return count_less(key, false);
+}
+
+template< class Key, class T, class Compare >
+typename maslevtsov::Tree< Key, T, Compare >::size_type
+  maslevtsov::Tree< Key, T, Compare >::count_range(const Key& lo, const Key& hi) const noexcept
+{
+  if (compare_(hi, lo)) {
+    return 0;
+  }
+  return count_less(hi, true) - count_less(lo, false);
+}
+
+template< class Key, class T, class Compare >
+typename maslevtsov::Tree< Key, T, Compare >::Node* maslevtsov::Tree< Key, T, Compare >::create_node()
+{
+  return new Node{nullptr, nullptr, nullptr, nullptr, true, value_type(), value_type(), 1};
+}
+
+template< class Key, class T, class Compare >
+void maslevtsov::Tree< Key, T, Compare >::split_nodes(Node* node, value_type& to_insert, Node* spare,
+  Node* left_child, Node* right_child) noexcept
+{
+  Node* right_node = spare;
+  spare = spare->parent;
+  right_node->parent = nullptr;
+  Node* kids[4] = {node->left, node->middle, node->right, nullptr};
+  if (compare_(to_insert.first, node->data1.first)) {
+    std::swap(to_insert, node->data1);
+    std::swap(right_node->data1, node->data2);
+    kids[3] = kids[2];
+    kids[2] = kids[1];
+    kids[0] = left_child;
+    kids[1] = right_child;
+  } else if (compare_(to_insert.first, node->data2.first)) {
+    std::swap(right_node->data1, node->data2);
+    kids[3] = kids[2];
+    kids[1] = left_child;
+    kids[2] = right_child;
+  } else {
+    std::swap(right_node->data1, to_insert);
+    std::swap(to_insert, node->data2);
+    kids[2] = left_child;
+    kids[3] = right_child;
+  }
+  node->is_two = true;
+  node->left = kids[0];
+  node->middle = nullptr;
+  node->right = kids[1];
+  right_node->left = kids[2];
+  right_node->right = kids[3];
+  for (size_t i = 0; i != 4; ++i) {
+    if (kids[i]) {
+      kids[i]->parent = i < 2 ? node : right_node;
     }
   }
+  detail::recount(node);
+  detail::recount(right_node);
   Node* parent = node->parent;
   if (parent == dummy_root_) {
-    try {
-      node->data1 = values_to_split[1];
-      node->data2 = value_type();
-    } catch (...) {
-      delete left_node;
-      delete right_node;
-      clear_subtree(left_child);
-      clear_subtree(right_child);
-      std::terminate();
-    }
-    node->left = left_node;
-    left_node->parent = node;
-    node->right = right_node;
-    right_node->parent = node;
-    node->middle = nullptr;
-    node->is_two = true;
-    return;
+    Node* new_root = spare;
+    std::swap(new_root->data1, to_insert);
+    new_root->parent = dummy_root_;
+    new_root->left = node;
+    new_root->right = right_node;
+    node->parent = new_root;
+    right_node->parent = new_root;
+    detail::recount(new_root);
+    dummy_root_->left = new_root;
   } else if (parent->is_two) {
-    if (compare_(values_to_split[1].first, parent->data1.first)) {
-      try {
-        parent->data2 = parent->data1;
-        parent->data1 = values_to_split[1];
-      } catch (...) {
-        delete left_node;
-        delete right_node;
-        clear_subtree(left_child);
-        clear_subtree(right_child);
-        std::terminate();
-      }
-      parent->left = left_node;
+    if (parent->left == node) {
+      std::swap(parent->data2, parent->data1);
+      std::swap(parent->data1, to_insert);
       parent->middle = right_node;
     } else {
-      try {
-        parent->data2 = values_to_split[1];
-      } catch (...) {
-        delete left_node;
-        delete right_node;
-        clear_subtree(left_child);
-        clear_subtree(right_child);
-        std::terminate();
-      }
-      parent->middle = left_node;
+      std::swap(parent->data2, to_insert);
+      parent->middle = node;
       parent->right = right_node;
     }
     parent->is_two = false;
-    left_node->parent = parent;
     right_node->parent = parent;
-    delete node;
-    return;
+    update_sizes(parent);
   } else {
-    split_nodes(parent, values_to_split[1], left_node, right_node);
+    split_nodes(parent, to_insert, spare, node, right_node);
   }
 }
 
@@ -543,6 +638,68 @@ void maslevtsov::Tree< Key, T, Compare >::clear_subtree(Node* node) noexcept
   delete node;
 }
 
+template< class Key, class T, class Compare >
+template< class InputIt >
+void maslevtsov::Tree< Key, T, Compare >::build_sorted(InputIt first, size_type count)
+{
+  if (count == 0) {
+    return;
+  }
+  size_type height = 1;
+  for (size_type capacity = 2; capacity < count; capacity = capacity * 3 + 2) {
+    ++height;
+  }
+  Node* root = build_subtree(first, count, height);
+  root->parent = dummy_root_;
+  dummy_root_->left = root;
+  size_ = count;
+}
+
+template< class Key, class T, class Compare >
+template< class InputIt >
+typename maslevtsov::Tree< Key, T, Compare >::Node*
+  maslevtsov::Tree< Key, T, Compare >::build_subtree(InputIt& first, size_type count, size_type height)
+{
+  Node* node = create_node();
+  try {
+    if (height == 1) {
+      node->data1 = *first;
+      ++first;
+      if (count == 2) {
+        node->data2 = *first;
+        ++first;
+        node->is_two = false;
+      }
+    } else {
+      size_type min_child_count = (size_type(1) << (height - 1)) - 1;
+      size_type children_count = count - 2 >= 3 * min_child_count ? 3 : 2;
+      size_type rest = count - (children_count - 1);
+      node->is_two = children_count == 2;
+      for (size_type i = 0; i != children_count; ++i) {
+        size_type child_count = rest / children_count + (i < rest % children_count ? 1 : 0);
+        Node* child = build_subtree(first, child_count, height - 1);
+        child->parent = node;
+        if (i == 0) {
+          node->left = child;
+          node->data1 = *first;
+          ++first;
+        } else if (i + 1 != children_count) {
+          node->middle = child;
+          node->data2 = *first;
+          ++first;
+        } else {
+          node->right = child;
+        }
+      }
+    }
+  } catch (...) {
+    clear_subtree(node);
+    throw;
+  }
+  detail::recount(node);
+  return node;
+}
+
 template< class Key, class T, class Compare >
 void maslevtsov::Tree< Key, T, Compare >::assign_value(value_type& dist, const value_type& src)
 {
@@ -553,278 +710,163 @@ void maslevtsov::Tree< Key, T, Compare >::assign_value(value_type& dist, const v
   }
 }
 
+template< class Key, class T, class Compare >
+void maslevtsov::Tree< Key, T, Compare >::update_sizes(Node* node) noexcept
+{
+  while (node != dummy_root_) {
+    detail::recount(node);
+    node = node->parent;
+  }
+}
+
 template< class Key, class T, class Compare >
 void maslevtsov::Tree< Key, T, Compare >::erase_from_leaf(iterator pos) noexcept
 {
-  if (!pos.node_->is_two) {
+  Node* leaf = pos.node_;
+  if (!leaf->is_two) {
     if (pos.is_first_) {
-      std::swap(pos.node_->data1, pos.node_->data2);
+      std::swap(leaf->data1, leaf->data2);
     }
-    pos.node_->is_two = true;
-    assign_value(pos.node_->data2, value_type());
+    leaf->is_two = true;
+    assign_value(leaf->data2, value_type());
+    update_sizes(leaf);
   } else {
-    Node* to_delete = pos.node_;
-    assign_value(to_delete->data1, value_type());
-    if (!to_delete->parent->is_two) {
-      balance_parent_three(to_delete);
-    } else {
-      balance_parent_two(to_delete);
-    }
+    assign_value(leaf->data1, value_type());
+    balance_hole(leaf);
   }
 }
 
 template< class Key, class T, class Compare >
-void maslevtsov::Tree< Key, T, Compare >::balance_parent_three(Node* deleted) noexcept
+void maslevtsov::Tree< Key, T, Compare >::balance_hole(Node* hole) noexcept
 {
-  Node* parent = deleted->parent;
-  if (parent->middle == deleted) {
-    if (!parent->right->is_two) {
-      std::swap(deleted->data1, parent->data2);
-      std::swap(parent->data2, parent->right->data1);
-      std::swap(parent->right->data1, parent->right->data2);
-      assign_value(parent->right->data2, value_type());
-      parent->right->is_two = true;
-    } else if (!parent->left->is_two) {
-      std::swap(deleted->data1, parent->data1);
-      std::swap(parent->data1, parent->left->data2);
-      assign_value(parent->left->data2, value_type());
-      parent->left->is_two = true;
-    } else {
-      std::swap(parent->data2, parent->right->data2);
-      std::swap(parent->right->data1, parent->right->data2);
-      parent->right->is_two = false;
-      parent->is_two = true;
-      assign_value(parent->middle->data1, value_type());
-      delete parent->middle;
-      parent->middle = nullptr;
-    }
-  } else if (parent->left == deleted) {
-    if (!parent->middle->is_two) {
-      std::swap(deleted->data1, parent->data1);
-      std::swap(parent->data1, parent->middle->data1);
-      std::swap(parent->middle->data1, parent->middle->data2);
-      assign_value(parent->middle->data2, value_type());
-      parent->middle->is_two = true;
-    } else {
-      std::swap(parent->data1, parent->middle->data2);
-      std::swap(parent->data1, parent->data2);
-      std::swap(parent->middle->data1, parent->middle->data2);
-      parent->middle->is_two = false;
-      parent->is_two = true;
-      assign_value(parent->left->data1, value_type());
-      delete parent->left;
-      parent->left = parent->middle;
-      parent->middle = nullptr;
+  Node* parent = hole->parent;
+  if (parent == dummy_root_) {
+    dummy_root_->left = hole->left;
+    if (hole->left) {
+      hole->left->parent = dummy_root_;
     }
+    delete hole;
+    return;
+  }
+  size_t index = detail::get_child_index(parent, hole);
+  size_t keys_count = parent->is_two ? 1 : 2;
+  Node* left_sibling = index > 0 ? detail::get_child(parent, index - 1) : nullptr;
+  Node* right_sibling = index < keys_count ? detail::get_child(parent, index + 1) : nullptr;
+  if (left_sibling && !left_sibling->is_two) {
+    rotate_from_left(hole, left_sibling, index == 1 ? parent->data1 : parent->data2);
+    update_sizes(parent);
+  } else if (right_sibling && !right_sibling->is_two) {
+    rotate_from_right(hole, right_sibling, index == 0 ? parent->data1 : parent->data2);
+    update_sizes(parent);
+  } else if (left_sibling) {
+    merge_into_sibling(hole, index, left_sibling, index == 1 ? parent->data1 : parent->data2);
   } else {
-    if (!parent->middle->is_two) {
-      std::swap(deleted->data1, parent->data2);
-      std::swap(parent->data2, parent->middle->data2);
-      assign_value(parent->middle->data2, value_type());
-      parent->middle->is_two = true;
-    } else {
-      std::swap(parent->data2, parent->middle->data2);
-      parent->middle->is_two = false;
-      parent->is_two = true;
-      assign_value(parent->right->data1, value_type());
-      delete parent->right;
-      parent->right = parent->middle;
-      parent->middle = nullptr;
-    }
+    merge_into_sibling(hole, index, right_sibling, parent->data1);
   }
 }
 
 template< class Key, class T, class Compare >
-void maslevtsov::Tree< Key, T, Compare >::balance_parent_two(Node* deleted) noexcept
+void maslevtsov::Tree< Key, T, Compare >::rotate_from_left(Node* hole, Node* sibling, value_type& separator) noexcept
 {
-  Node* parent = deleted->parent;
-  if (parent->left == deleted && !parent->right->is_two) {
-    std::swap(parent->data1, parent->left->data1);
-    std::swap(parent->data1, parent->right->data1);
-    std::swap(parent->right->data1, parent->right->data2);
-    assign_value(parent->right->data2, value_type());
-    parent->right->is_two = true;
-  } else if (parent->right == deleted && !parent->left->is_two) {
-    std::swap(parent->data1, parent->right->data1);
-    std::swap(parent->data1, parent->left->data2);
-    assign_value(parent->left->data2, value_type());
-    parent->left->is_two = true;
-  } else {
-    balance_parent_bro_two(deleted);
+  std::swap(hole->data1, separator);
+  std::swap(separator, sibling->data2);
+  hole->right = hole->left;
+  hole->left = sibling->right;
+  if (hole->left) {
+    hole->left->parent = hole;
   }
+  sibling->right = sibling->middle;
+  sibling->middle = nullptr;
+  sibling->is_two = true;
+  detail::recount(sibling);
+  detail::recount(hole);
 }
 
 template< class Key, class T, class Compare >
-void maslevtsov::Tree< Key, T, Compare >::balance_parent_bro_two(Node* deleted) noexcept
+void maslevtsov::Tree< Key, T, Compare >::rotate_from_right(Node* hole, Node* sibling, value_type& separator) noexcept
 {
-  Node* parent = deleted->parent;
-  assign_value(deleted->data1, value_type());
-  if (parent->left == deleted) {
-    delete deleted;
-    parent->left = nullptr;
-    std::swap(parent->data1, parent->right->data2);
-    std::swap(parent->right->data1, parent->right->data2);
-    std::swap(parent->left, parent->right);
-  } else {
-    delete deleted;
-    parent->right = nullptr;
-    std::swap(parent->data1, parent->left->data2);
-  }
-  parent->left->is_two = false;
-  Node* current = parent;
-  Node* cur_parent = current->parent;
-  bool is_balanced = false;
-  while (cur_parent != dummy_root_) {
-    if (cur_parent->is_two) {
-      is_balanced = balance_next_parent_two(current, cur_parent);
-    } else {
-      balance_next_parent_three(current, cur_parent);
-      is_balanced = true;
-    }
-    if (is_balanced) {
-      break;
-    }
-    current = cur_parent;
-    cur_parent = current->parent;
-  }
-  if (!is_balanced) {
-    dummy_root_->left = current->left;
-    current->left = nullptr;
-    delete current;
-    dummy_root_->left->parent = dummy_root_;
+  std::swap(hole->data1, separator);
+  std::swap(separator, sibling->data1);
+  std::swap(sibling->data1, sibling->data2);
+  hole->right = sibling->left;
+  if (hole->right) {
+    hole->right->parent = hole;
   }
+  sibling->left = sibling->middle;
+  sibling->middle = nullptr;
+  sibling->is_two = true;
+  detail::recount(sibling);
+  detail::recount(hole);
 }
 
 template< class Key, class T, class Compare >
-void maslevtsov::Tree< Key, T, Compare >::balance_next_parent_three(Node* deleted, Node* next_parent) noexcept
+void maslevtsov::Tree< Key, T, Compare >::merge_into_sibling(Node* hole, size_t hole_index, Node* sibling,
+  value_type& separator) noexcept
 {
-  if (next_parent->left == deleted) {
-    if (!next_parent->middle->is_two) {
-      std::swap(deleted->data1, next_parent->data1);
-      deleted->right = next_parent->middle->left;
-      std::swap(next_parent->data1, next_parent->middle->data1);
-      std::swap(next_parent->middle->data1, next_parent->middle->data2);
-      next_parent->middle->is_two = true;
-      next_parent->middle->left = next_parent->middle->middle;
-      next_parent->middle->middle = nullptr;
-    } else {
-      std::swap(next_parent->data1, next_parent->middle->data2);
-      std::swap(next_parent->data1, next_parent->data2);
-      std::swap(next_parent->middle->data1, next_parent->middle->data2);
-      next_parent->middle->is_two = false;
-      next_parent->is_two = true;
-      next_parent->middle->middle = next_parent->middle->left;
-      next_parent->middle->left = next_parent->left->left;
-      next_parent->left->left->parent = next_parent->middle;
-      next_parent->left->left = nullptr;
-      delete next_parent->left;
-      next_parent->left = next_parent->middle;
-      next_parent->middle = nullptr;
+  Node* parent = hole->parent;
+  Node* child = hole->left;
+  bool is_left_sibling = hole_index > 0;
+  if (is_left_sibling) {
+    std::swap(sibling->data2, separator);
+    sibling->middle = sibling->right;
+    sibling->right = child;
+  } else {
+    std::swap(sibling->data2, sibling->data1);
+    std::swap(sibling->data1, separator);
+    sibling->middle = sibling->left;
+    sibling->left = child;
+  }
+  if (child) {
+    child->parent = sibling;
+  }
+  sibling->is_two = false;
+  detail::recount(sibling);
+  delete hole;
+  if (!parent->is_two) {
+    if (hole_index == 0 || (is_left_sibling && hole_index == 1)) {
+      std::swap(parent->data1, parent->data2);
     }
-  } else if (next_parent->middle == deleted) {
-    if (!next_parent->left->is_two) {
-      std::swap(deleted->data1, next_parent->data1);
-      deleted->right = deleted->left;
-      deleted->left = next_parent->left->right;
-      next_parent->left->right->parent = deleted;
-      std::swap(next_parent->data1, next_parent->left->data2);
-      next_parent->left->is_two = true;
-      next_parent->left->right = next_parent->left->middle;
-      next_parent->left->middle = nullptr;
-    } else if (!next_parent->right->is_two) {
-      std::swap(deleted->data1, next_parent->data2);
-      deleted->right = next_parent->right->left;
-      std::swap(next_parent->data2, next_parent->right->data1);
-      std::swap(next_parent->right->data1, next_parent->right->data2);
-      next_parent->right->is_two = true;
-      next_parent->right->left = next_parent->right->middle;
-      next_parent->right->middle = nullptr;
-    } else {
-      std::swap(next_parent->data1, next_parent->left->data2);
-      std::swap(next_parent->data1, next_parent->data2);
-      next_parent->left->is_two = false;
-      next_parent->is_two = true;
-      next_parent->left->middle = next_parent->left->right;
-      next_parent->left->right = next_parent->middle->left;
-      next_parent->middle->left->parent = next_parent->left;
-      next_parent->middle->left = nullptr;
-      delete next_parent->middle;
-      next_parent->middle = nullptr;
+    assign_value(parent->data2, value_type());
+    if (hole_index == 0) {
+      parent->left = parent->middle;
+    } else if (hole_index == 2) {
+      parent->right = parent->middle;
     }
+    parent->middle = nullptr;
+    parent->is_two = true;
+    update_sizes(parent);
   } else {
-    if (!next_parent->middle->is_two) {
-      std::swap(deleted->data1, next_parent->data2);
-      deleted->right = deleted->left;
-      deleted->left = next_parent->middle->right;
-      next_parent->middle->right->parent = deleted;
-      std::swap(next_parent->data2, next_parent->middle->data2);
-      next_parent->middle->is_two = true;
-      next_parent->middle->right = next_parent->middle->middle;
-      next_parent->middle->middle = nullptr;
-    } else {
-      std::swap(next_parent->data2, next_parent->middle->data2);
-      next_parent->middle->is_two = false;
-      next_parent->is_two = true;
-      next_parent->middle->middle = next_parent->middle->right;
-      next_parent->middle->right = next_parent->right->left;
-      next_parent->right->left->parent = next_parent->middle;
-      next_parent->right->left = nullptr;
-      delete next_parent->right;
-      next_parent->right = next_parent->middle;
-      next_parent->middle = nullptr;
-    }
+    assign_value(parent->data1, value_type());
+    parent->left = sibling;
+    parent->right = nullptr;
+    balance_hole(parent);
   }
 }
 
 template< class Key, class T, class Compare >
-bool maslevtsov::Tree< Key, T, Compare >::balance_next_parent_two(Node* deleted, Node* next_parent) noexcept
+typename maslevtsov::Tree< Key, T, Compare >::size_type
+  maslevtsov::Tree< Key, T, Compare >::count_less(const Key& key, bool is_inclusive) const noexcept
 {
-  if (next_parent->left == deleted) {
-    if (next_parent->right->is_two) {
-      std::swap(next_parent->data1, next_parent->right->data2);
-      std::swap(next_parent->right->data1, next_parent->right->data2);
-      next_parent->right->is_two = false;
-      next_parent->right->middle = next_parent->right->left;
-      next_parent->right->left = deleted->left;
-      deleted->left->parent = next_parent->right;
-      deleted->left = nullptr;
-      delete deleted;
-      next_parent->left = next_parent->right;
-      next_parent->right = nullptr;
-      return false;
-    } else {
-      std::swap(deleted->data1, next_parent->data1);
-      deleted->right = next_parent->right->left;
-      next_parent->right->left->parent = deleted;
-      std::swap(next_parent->data1, next_parent->right->data1);
-      std::swap(next_parent->right->data1, next_parent->right->data2);
-      next_parent->right->is_two = true;
-      next_parent->right->left = next_parent->right->middle;
-      next_parent->right->middle = nullptr;
-      return true;
+  size_t result = 0;
+  Node* current = dummy_root_->left;
+  while (current) {
+    bool is_counted = is_inclusive ? !compare_(key, current->data1.first) : compare_(current->data1.first, key);
+    if (!is_counted) {
+      current = current->left;
+      continue;
     }
-  } else {
-    if (next_parent->left->is_two) {
-      std::swap(next_parent->data1, next_parent->left->data2);
-      next_parent->left->is_two = false;
-      next_parent->left->middle = next_parent->left->right;
-      next_parent->left->right = deleted->left;
-      deleted->left->parent = next_parent->left;
-      deleted->left = nullptr;
-      delete deleted;
-      next_parent->right = nullptr;
-      return false;
-    } else {
-      std::swap(deleted->data1, next_parent->data1);
-      deleted->right = deleted->left;
-      deleted->left = next_parent->left->right;
-      std::swap(next_parent->data1, next_parent->right->data2);
-      next_parent->left->is_two = true;
-      next_parent->left->right = next_parent->right->middle;
-      next_parent->left->middle = nullptr;
-      return true;
+    result += detail::get_size(current->left) + 1;
+    if (!current->is_two) {
+      is_counted = is_inclusive ? !compare_(key, current->data2.first) : compare_(current->data2.first, key);
+      if (!is_counted) {
+        current = current->middle;
+        continue;
+      }
+      result += detail::get_size(current->middle) + 1;
     }
+    current = current->right;
   }
+  return result;
 }
 
 template< class Key, class T, class Compare >
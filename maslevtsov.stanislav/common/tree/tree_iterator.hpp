@@ -24,9 +24,9 @@ namespace maslevtsov {
     TreeIterator();
 
     TreeIterator& operator++();
-    TreeIterator& operator++(int);
+    TreeIterator operator++(int);
     TreeIterator& operator--();
-    TreeIterator& operator--(int);
+    TreeIterator operator--(int);
 
     typename std::conditional< it_type == detail::TreeIteratorType::CONSTANT, const T&, T& >::type operator*() const;
     typename std::conditional< it_type == detail::TreeIteratorType::CONSTANT, const T*, T* >::type operator->() const;
@@ -97,7 +97,7 @@ namespace maslevtsov {
   }
 
   template< class T, detail::TreeIteratorType it_type >
-  typename TreeIterator< T, it_type >::TreeIterator& TreeIterator< T, it_type >::operator++(int)
+  typename TreeIterator< T, it_type >::TreeIterator TreeIterator< T, it_type >::operator++(int)
   {
     TreeIterator< T, it_type > result(*this);
     ++(*this);
@@ -153,7 +153,7 @@ namespace maslevtsov {
   }
 
   template< class T, detail::TreeIteratorType it_type >
-  typename TreeIterator< T, it_type >::TreeIterator& TreeIterator< T, it_type >::operator--(int)
+  typename TreeIterator< T, it_type >::TreeIterator TreeIterator< T, it_type >::operator--(int)
   {
     TreeIterator< T, it_type > result(*this);
     --(*this);
@@ -1,6 +1,8 @@
 #ifndef TREE_NODE_HPP
 #define TREE_NODE_HPP
 
+#include <cstddef>
+
 namespace maslevtsov {
   template< class T >
   struct TreeNode
@@ -12,6 +14,7 @@ namespace maslevtsov {
     bool is_two;
     T data1;
     T data2;
+    std::size_t size;
   };
 }
 
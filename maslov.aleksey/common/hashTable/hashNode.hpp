@@ -1,6 +1,7 @@
 #ifndef HASH_NODE_HPP
 #define HASH_NODE_HPP
 
+#include <cstddef>
 #include <utility>
 
 namespace maslov
@@ -9,6 +10,8 @@ namespace maslov
   struct HashNode
   {
     std::pair< Key, T > data;
+    size_t hash1 = 0;
+    size_t hash2 = 0;
     bool occupied = false;
     bool deleted = false;
   };
@@ -1,6 +1,7 @@
 #ifndef HASH_TABLE_HPP
 #define HASH_TABLE_HPP
 
+#include <string>
 #include <boost/hash2/xxhash.hpp>
 #include "iterator.hpp"
 #include "hashNode.hpp"
@@ -17,6 +18,27 @@ namespace maslov::detail
       return hasher.result();
     }
   };
+
+  template<>
+  struct XXHash< std::string >
+  {
+    size_t operator()(const std::string & key) const
+    {
+      boost::hash2::xxhash_64 hasher;
+      hasher.update(key.data(), key.size());
+      return hasher.result();
+    }
+  };
+
+  inline size_t ceilPowerOfTwo(size_t value) noexcept
+  {
+    size_t result = 1;
+    while (result < value)
+    {
+      result <<= 1;
+    }
+    return result;
+  }
 }
 
 namespace maslov
@@ -28,7 +50,7 @@ namespace maslov
     using iterator = HashIterator< Key, T, HS1, HS2, EQ >;
 
     HashTable();
-    HashTable(size_t capacity);
+    HashTable(size_t capacity, const HS1 & hash1 = HS1(), const HS2 & hash2 = HS2(), const EQ & equal = EQ());
     HashTable(const HashTable & rhs);
     HashTable(HashTable && rhs) noexcept;
     template< class InputIt >
@@ -82,20 +104,26 @@ namespace maslov
     size_t capacity_;
     size_t size_;
     float maxLoadFactor_= 0.7f;
-    std::pair< size_t, size_t > calculatePositions(const Key & key) const noexcept;
-    std::pair< size_t, bool > findPosition(const Key & key) const noexcept;
+    HS1 hasher1_;
+    HS2 hasher2_;
+    EQ equal_;
+    std::pair< size_t, size_t > calculateHashes(const Key & key) const noexcept;
+    std::pair< size_t, bool > findPosition(const Key & key, std::pair< size_t, size_t > hashes) const noexcept;
   };
 
   template< class Key, class T, class HS1, class HS2, class EQ >
   HashTable< Key, T, HS1, HS2, EQ >::HashTable():
-    HashTable(10)
+    HashTable(16)
   {}
 
   template< class Key, class T, class HS1, class HS2, class EQ >
-  HashTable< Key, T, HS1, HS2, EQ >::HashTable(size_t capacity):
-    slots_(new HashNode< Key, T >[capacity]),
-    capacity_(capacity),
-    size_(0)
+  HashTable< Key, T, HS1, HS2, EQ >::HashTable(size_t capacity, const HS1 & hash1, const HS2 & hash2, const EQ & equal):
+    slots_(new HashNode< Key, T >[detail::ceilPowerOfTwo(capacity)]),
+    capacity_(detail::ceilPowerOfTwo(capacity)),
+    size_(0),
+    hasher1_(hash1),
+    hasher2_(hash2),
+    equal_(equal)
   {}
 
   template< class Key, class T, class HS1, class HS2, class EQ >
@@ -121,11 +149,14 @@ namespace maslov
   HashTable< Key, T, HS1, HS2, EQ >::HashTable(const HashTable & rhs):
     slots_(new HashNode< Key, T >[rhs.capacity_]),
     capacity_(rhs.capacity_),
-    size_(rhs.size_)
+    size_(rhs.size_),
+    hasher1_(rhs.hasher1_),
+    hasher2_(rhs.hasher2_),
+    equal_(rhs.equal_)
   {
     for (size_t i = 0; i < capacity_; ++i)
     {
-      if (rhs.slots_[i].occupied && !rhs.slots_[i].deleted)
+      if (rhs.slots_[i].occupied)
       {
         slots_[i] = rhs.slots_[i];
       }
@@ -136,7 +167,10 @@ namespace maslov
   HashTable< Key, T, HS1, HS2, EQ >::HashTable(HashTable && rhs) noexcept:
     slots_(rhs.slots_),
     capacity_(rhs.capacity_),
-    size_(rhs.size_)
+    size_(rhs.size_),
+    hasher1_(std::move(rhs.hasher1_)),
+    hasher2_(std::move(rhs.hasher2_)),
+    equal_(std::move(rhs.equal_))
   {
     rhs.slots_ = nullptr;
     rhs.capacity_ = 0;
@@ -163,6 +197,9 @@ namespace maslov
       slots_ = rhs.slots_;
       capacity_ = rhs.capacity_;
       size_ = rhs.size_;
+      hasher1_ = std::move(rhs.hasher1_);
+      hasher2_ = std::move(rhs.hasher2_);
+      equal_ = std::move(rhs.equal_);
       rhs.slots_ = nullptr;
       rhs.capacity_ = 0;
       rhs.size_ = 0;
@@ -191,6 +228,7 @@ namespace maslov
   template< class Key, class T, class HS1, class HS2, class EQ >
   void HashTable< Key, T, HS1, HS2, EQ >::rehash(size_t newCapacity)
   {
+    newCapacity = detail::ceilPowerOfTwo(newCapacity);
     if (newCapacity <= capacity_)
     {
       return;
@@ -199,12 +237,21 @@ namespace maslov
     try
     {
       tmp = new HashNode< Key, T >[newCapacity];
+      size_t mask = newCapacity - 1;
       for (size_t i = 0; i < capacity_; ++i)
       {
         if (slots_[i].occupied && !slots_[i].deleted)
         {
-          auto pos = findPosition(slots_[i].data.first);
-          tmp[pos.first] = slots_[i];
+          size_t index = slots_[i].hash1 & mask;
+          size_t step = (slots_[i].hash2 & mask) | 1;
+          while (tmp[index].occupied)
+          {
+            index = (index + step) & mask;
+          }
+          tmp[index].data = std::move_if_noexcept(slots_[i].data);
+          tmp[index].hash1 = slots_[i].hash1;
+          tmp[index].hash2 = slots_[i].hash2;
+          tmp[index].occupied = true;
         }
       }
     }
@@ -225,22 +272,22 @@ namespace maslov
   }
 
   template< class Key, class T, class HS1, class HS2, class EQ >
-  std::pair< size_t, size_t > HashTable< Key, T, HS1, HS2, EQ >::calculatePositions(const Key & key) const noexcept
+  std::pair< size_t, size_t > HashTable< Key, T, HS1, HS2, EQ >::calculateHashes(const Key & key) const noexcept
   {
-    size_t h1 = HS1{}(key) % capacity_;
-    size_t h2 = HS2{}(key) % (capacity_ - 1) + 1;
-    return {h1, h2};
+    return {hasher1_(key), hasher2_(key)};
   }
 
   template< class Key, class T, class HS1, class HS2, class EQ >
-  std::pair< size_t, bool > HashTable< Key, T, HS1, HS2, EQ >::findPosition(const Key & key) const noexcept
+  std::pair< size_t, bool > HashTable< Key, T, HS1, HS2, EQ >::findPosition(const Key & key, std::pair< size_t, size_t > hashes) const noexcept
   {
-    auto pos = calculatePositions(key);
+    size_t mask = capacity_ - 1;
+    size_t index = hashes.first & mask;
+    size_t step = (hashes.second & mask) | 1;
     size_t deleted = capacity_;
     for (size_t i = 0; i < capacity_; ++i)
     {
-      size_t index = (pos.first + i * pos.second) % capacity_;
-      if (!slots_[index].occupied)
+      const HashNode< Key, T > & slot = slots_[index];
+      if (!slot.occupied)
       {
         if (deleted != capacity_)
         {
@@ -251,16 +298,20 @@ namespace maslov
           return {index, true};
         }
       }
-      else if (slots_[index].deleted && deleted == capacity_)
+      else if (slot.deleted)
       {
-        deleted = index;
+        if (deleted == capacity_)
+        {
+          deleted = index;
+        }
       }
-      else if (EQ{}(slots_[index].data.first, key))
+      else if (slot.hash1 == hashes.first && equal_(slot.data.first, key))
       {
         return {index, false};
       }
+      index = (index + step) & mask;
     }
-    return {capacity_, false};
+    return {deleted, deleted != capacity_};
   }
 
   template< class Key, class T, class HS1, class HS2, class EQ >
@@ -290,7 +341,7 @@ namespace maslov
   template< class Key, class T, class HS1, class HS2, class EQ >
   HashIterator< Key, T, HS1, HS2, EQ > HashTable< Key, T, HS1, HS2, EQ >::find(const Key & key) noexcept
   {
-    auto pair = findPosition(key);
+    auto pair = findPosition(key, calculateHashes(key));
     size_t pos = pair.first;
     bool hasFind = pair.second;
     if (hasFind || pos == capacity_)
@@ -303,7 +354,7 @@ namespace maslov
   template< class Key, class T, class HS1, class HS2, class EQ >
   HashConstIterator< Key, T, HS1, HS2, EQ > HashTable<Key, T, HS1, HS2, EQ >::find(const Key & key) const noexcept
   {
-    auto pair = findPosition(key);
+    auto pair = findPosition(key, calculateHashes(key));
     size_t pos = pair.first;
     bool hasFind = pair.second;
     if (hasFind || pos == capacity_)
@@ -368,7 +419,6 @@ namespace maslov
       return end();
     }
     size_t index = pos.current_;
-    slots_[index].occupied = false;
     slots_[index].deleted = true;
     size_--;
     return iterator(slots_, capacity_, index);
@@ -410,6 +460,9 @@ namespace maslov
     std::swap(slots_, rhs.slots_);
     std::swap(capacity_, rhs.capacity_);
     std::swap(size_, rhs.size_);
+    std::swap(hasher1_, rhs.hasher1_);
+    std::swap(hasher2_, rhs.hasher2_);
+    std::swap(equal_, rhs.equal_);
   }
 
   template< class Key, class T, class HS1, class HS2, class EQ >
@@ -450,8 +503,8 @@ namespace maslov
       rehash(capacity_ * 2);
     }
     std::pair< Key, T > temp(std::forward< Args >(args)...);
-    const Key & key = temp.first;
-    auto pair = findPosition(key);
+    auto hashes = calculateHashes(temp.first);
+    auto pair = findPosition(temp.first, hashes);
     size_t pos = pair.first;
     bool hasFind = pair.second;
 
@@ -462,6 +515,8 @@ namespace maslov
     if (hasFind)
     {
       slots_[pos].data = std::move(temp);
+      slots_[pos].hash1 = hashes.first;
+      slots_[pos].hash2 = hashes.second;
       slots_[pos].occupied = true;
       slots_[pos].deleted = false;
       size_++;
@@ -480,7 +535,7 @@ namespace maslov
       if (slot.occupied && !slot.deleted)
       {
         std::pair< Key, T > temp(std::forward< Args >(args)...);
-        if (EQ{}(slot.data.first, temp.first))
+        if (equal_(slot.data.first, temp.first))
         {
           return iterator(slots_, capacity_, hint.current_);
         }
@@ -163,7 +163,11 @@ namespace petrov
     template< class... Args >
     void pushBackImpl(Args && ... args);
     template< typename Compare >
-    void sortImpl(node_t * low, node_t * high, Compare comp);
+    void sortImpl(Compare comp);
+    template< typename Compare >
+    static node_t * runEnd(node_t ** link, Compare comp);
+    template< typename Compare >
+    static node_t * mergeRuns(node_t ** link, node_t * left_last, node_t * right_last, Compare comp);
   };
 
   template< typename T >
@@ -1021,14 +1025,14 @@ namespace petrov
   template< typename T >
   void ForwardRingList< T >::sort()
   {
-    sortImpl(head_, tail_, std::less_equal< T >{});
+    sortImpl(std::less< T >{});
   }
 
   template< typename T >
   template< typename Compare >
   void ForwardRingList< T >::sort(Compare comp)
   {
-    sortImpl(head_, tail_, comp);
+    sortImpl(comp);
   }
 
   template< typename T >
@@ -1108,33 +1112,94 @@ namespace petrov
 
   template< typename T >
   template< typename Compare >
-  void ForwardRingList< T >::sortImpl(node_t * low, node_t * high, Compare comp)
+  void ForwardRingList< T >::sortImpl(Compare comp)
   {
-    if (low != high && !(high != tail_ && high->next == low))
+    if (size_ < 2)
     {
-      node_t fake(low, T());
-      node_t * i = &fake;
-      T pivot = high->data;
-      for (auto j = low; j != high; j = j->next)
+      return;
+    }
+    tail_->next = nullptr;
+    try
+    {
+      size_t runs = 0;
+      do
       {
-        if (comp(j->data, pivot))
+        runs = 0;
+        node_t ** link = &head_;
+        while (*link != nullptr)
         {
-          std::swap(i->next->data, j->data);
-          i = i->next;
+          node_t * left_last = runEnd(link, comp);
+          runs++;
+          if (left_last->next == nullptr)
+          {
+            tail_ = left_last;
+            break;
+          }
+          node_t * right_last = runEnd(&left_last->next, comp);
+          tail_ = mergeRuns(link, left_last, right_last, comp);
+          link = &tail_->next;
         }
       }
-      std::swap(i->next->data, high->data);
-      if (i->next == high)
+      while (runs > 1);
+    }
+    catch (...)
+    {
+      tail_ = head_;
+      while (tail_->next != nullptr)
+      {
+        tail_ = tail_->next;
+      }
+      tail_->next = head_;
+      throw;
+    }
+    tail_->next = head_;
+  }
+
+  template< typename T >
+  template< typename Compare >
+  typename ForwardRingList< T >::node_t * ForwardRingList< T >::runEnd(node_t ** link, Compare comp)
+  {
+    node_t * last = *link;
+    while (last->next != nullptr && comp(last->next->data, (*link)->data))
+    {
+      node_t * moved = last->next;
+      last->next = moved->next;
+      moved->next = *link;
+      *link = moved;
+    }
+    while (last->next != nullptr && !comp(last->next->data, last->data))
+    {
+      last = last->next;
+    }
+    return last;
+  }
+
+  template< typename T >
+  template< typename Compare >
+  typename ForwardRingList< T >::node_t * ForwardRingList< T >::mergeRuns(node_t ** link, node_t * left_last,
+      node_t * right_last, Compare comp)
+  {
+    node_t * rest = right_last->next;
+    node_t * left = *link;
+    node_t * right = left_last->next;
+    while (left != right && right != rest)
+    {
+      if (comp(right->data, left->data))
       {
-        sortImpl(low, i, comp);
-        sortImpl(i->next, high, comp);
+        node_t * moved = right;
+        right = right->next;
+        left_last->next = right;
+        moved->next = left;
+        *link = moved;
+        link = &moved->next;
       }
       else
       {
-        sortImpl(low, i, comp);
-        sortImpl(i->next->next, high, comp);
+        link = &left->next;
+        left = left->next;
       }
     }
+    return right == rest ? left_last : right_last;
   }
 }
 
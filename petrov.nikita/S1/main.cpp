@@ -1,38 +1,83 @@
 #include <string>
+#include <utility>
 #include <iostream>
 #include <limits>
+#include <algorithm>
+#include <stdexcept>
+#include <dynamic_array.hpp>
 #include "forward_ring_list.hpp"
 
 namespace petrov
 {
   using pair_of_string_and_list = std::pair< std::string, petrov::ForwardRingList< size_t > >;
   using list_type = ForwardRingList< pair_of_string_and_list >;
-  using list_it_t = ForwardListIterator< pair_of_string_and_list >;
-  using sublist_it_t = ForwardListIterator< size_t >;
+  using sublist_const_it_t = ConstForwardListIterator< size_t >;
+  using cursor_type = std::pair< sublist_const_it_t, size_t >;
   using result_list_type = ForwardRingList< size_t >;
+  struct SequencesBuffer
+  {
+    DynamicArray< std::string > names;
+    DynamicArray< size_t > offsets;
+    DynamicArray< size_t > values;
+  };
   std::istream & inputValuesIntoFwdRingList(std::istream & in, list_type & fwd_ring_list);
+  std::istream & inputValuesIntoBuffer(std::istream & in, SequencesBuffer & buffer);
   std::ostream & outputNamesOfSequences(std::ostream & out, const list_type & fwd_ring_list);
-  result_list_type getListOfSumsFromListOfSequences(list_type fwd_ring_list);
-  void addElementToSumAndPopFrontIt(size_t & sum, list_it_t it_out, sublist_it_t it);
-  std::ostream & outputSums(std::ostream & out, const result_list_type sums);
+  std::ostream & outputNamesOfSequences(std::ostream & out, const SequencesBuffer & buffer);
+  result_list_type getListOfSumsFromListOfSequences(std::ostream & out, const list_type & fwd_ring_list);
+  result_list_type getListOfSumsFromBuffer(std::ostream & out, const SequencesBuffer & buffer);
+  void outputElementAndAddToSum(std::ostream & out, size_t & sum, size_t element);
+  std::ostream & outputSums(std::ostream & out, const result_list_type & sums);
 }
 
-int main()
+namespace
+{
+  bool processList(std::istream & in, std::ostream & out, petrov::result_list_type & sums)
+  {
+    petrov::list_type fwd_ring_list = {};
+    petrov::inputValuesIntoFwdRingList(in, fwd_ring_list);
+    if (fwd_ring_list.empty())
+    {
+      return false;
+    }
+    petrov::outputNamesOfSequences(out, fwd_ring_list);
+    sums = petrov::getListOfSumsFromListOfSequences(out, fwd_ring_list);
+    return true;
+  }
+
+  bool processBuffer(std::istream & in, std::ostream & out, petrov::result_list_type & sums)
+  {
+    petrov::SequencesBuffer buffer;
+    petrov::inputValuesIntoBuffer(in, buffer);
+    if (buffer.names.empty())
+    {
+      return false;
+    }
+    petrov::outputNamesOfSequences(out, buffer);
+    sums = petrov::getListOfSumsFromBuffer(out, buffer);
+    return true;
+  }
+}
+
+int main(int argc, const char * const * argv)
 {
   using namespace petrov;
-  list_type fwd_ring_list = {};
+  if (argc > 2 || (argc == 2 && std::string(argv[1]) != "--soa"))
+  {
+    std::cerr << "ERROR: Wrong arguments";
+    std::cerr << "\n";
+    return 1;
+  }
   result_list_type sums = {};
   try
   {
-    inputValuesIntoFwdRingList(std::cin, fwd_ring_list);
-    if (fwd_ring_list.empty())
+    bool has_sequences = (argc == 2) ? processBuffer(std::cin, std::cout, sums) : processList(std::cin, std::cout, sums);
+    if (!has_sequences)
     {
       std::cout << 0;
       std::cout << "\n";
       return 0;
     }
-    outputNamesOfSequences(std::cout, fwd_ring_list);
-    sums = getListOfSumsFromListOfSequences(fwd_ring_list);
   }
   catch (const std::exception & e)
   {
@@ -75,13 +120,40 @@ std::istream & petrov::inputValuesIntoFwdRingList(std::istream & in, list_type &
       sublist.push_front(number);
     }
     sublist.reverse();
-    pair_of_string_and_list new_pair = { sequence_name, sublist };
-    fwd_ring_list.push_front(new_pair);
+    fwd_ring_list.emplace_front(sequence_name, std::move(sublist));
   }
   fwd_ring_list.reverse();
   return in;
 }
 
+std::istream & petrov::inputValuesIntoBuffer(std::istream & in, SequencesBuffer & buffer)
+{
+  std::string sequence_name = {};
+  size_t number = 0;
+  buffer.offsets.push_back(buffer.values.size());
+  while (!in.eof())
+  {
+    in.clear();
+    in >> sequence_name;
+    if (sequence_name.empty())
+    {
+      break;
+    }
+    while (!in.eof() && in)
+    {
+      in >> number;
+      if (!in)
+      {
+        break;
+      }
+      buffer.values.push_back(number);
+    }
+    buffer.names.push_back(sequence_name);
+    buffer.offsets.push_back(buffer.values.size());
+  }
+  return in;
+}
+
 std::ostream & petrov::outputNamesOfSequences(std::ostream & out, const list_type & fwd_ring_list)
 {
   auto it = fwd_ring_list.cbegin();
@@ -102,67 +174,92 @@ std::ostream & petrov::outputNamesOfSequences(std::ostream & out, const list_typ
   return out;
 }
 
-petrov::result_list_type petrov::getListOfSumsFromListOfSequences(list_type fwd_ring_list)
+std::ostream & petrov::outputNamesOfSequences(std::ostream & out, const SequencesBuffer & buffer)
+{
+  out << buffer.names[0];
+  for (size_t i = 1; i < buffer.names.size(); i++)
+  {
+    out << " " << buffer.names[i];
+  }
+  out << "\n";
+  return out;
+}
+
+petrov::result_list_type petrov::getListOfSumsFromListOfSequences(std::ostream & out, const list_type & fwd_ring_list)
 {
+  ForwardRingList< cursor_type > cursors = {};
+  size_t rows = 0;
+  auto it_out = fwd_ring_list.cbegin();
+  for (size_t i = 0; i < fwd_ring_list.size(); i++)
+  {
+    cursors.emplace_front(it_out->second.cbegin(), it_out->second.size());
+    rows = std::max(rows, it_out->second.size());
+    ++it_out;
+  }
+  cursors.reverse();
   result_list_type sums = {};
-  do
+  for (size_t row = 0; row < rows; row++)
   {
     size_t sum = 0;
-    auto prev_it_out = fwd_ring_list.end();
-    auto it_out = fwd_ring_list.begin();
-    if (it_out->second.empty() && fwd_ring_list.size() == 1)
+    bool first = true;
+    auto it = cursors.begin();
+    for (size_t i = 0; i < cursors.size(); i++)
     {
-      fwd_ring_list.pop_front();
-      break;
-    }
-    else
-    {
-      if (it_out->second.empty() && fwd_ring_list.size() != 1)
-      {
-        auto val = *it_out;
-        fwd_ring_list.remove(val);
-        it_out = prev_it_out;
-      }
-      else
+      if (row < it->second)
       {
-        auto it = it_out->second.begin();
-        std::cout << *it;
-        addElementToSumAndPopFrontIt(sum, it_out, it);
-        ++prev_it_out;
+        out << (first ? "" : " ");
+        outputElementAndAddToSum(out, sum, *(it->first));
+        ++(it->first);
+        first = false;
       }
-      while (it_out++ != fwd_ring_list.end())
+      ++it;
+    }
+    if (sum)
+    {
+      sums.push_front(sum);
+      out << "\n";
+    }
+  }
+  return sums;
+}
+
+petrov::result_list_type petrov::getListOfSumsFromBuffer(std::ostream & out, const SequencesBuffer & buffer)
+{
+  size_t rows = 0;
+  for (size_t i = 0; i < buffer.names.size(); i++)
+  {
+    rows = std::max(rows, buffer.offsets[i + 1] - buffer.offsets[i]);
+  }
+  result_list_type sums = {};
+  for (size_t row = 0; row < rows; row++)
+  {
+    size_t sum = 0;
+    bool first = true;
+    for (size_t i = 0; i < buffer.names.size(); i++)
+    {
+      size_t pos = buffer.offsets[i] + row;
+      if (pos < buffer.offsets[i + 1])
       {
-        if (it_out->second.empty() && fwd_ring_list.size() != 1)
-        {
-          auto val = *it_out;
-          fwd_ring_list.remove(val);
-          it_out = prev_it_out;
-        }
-        else
-        {
-          auto it = it_out->second.begin();
-          std::cout << " " << *it;
-          addElementToSumAndPopFrontIt(sum, it_out, it);
-          ++prev_it_out;
-        }
+        out << (first ? "" : " ");
+        outputElementAndAddToSum(out, sum, buffer.values[pos]);
+        first = false;
       }
     }
     if (sum)
     {
       sums.push_front(sum);
-      std::cout << "\n";
+      out << "\n";
     }
   }
-  while (!fwd_ring_list.empty());
   return sums;
 }
 
-void petrov::addElementToSumAndPopFrontIt(size_t & sum, list_it_t it_out, sublist_it_t it)
+void petrov::outputElementAndAddToSum(std::ostream & out, size_t & sum, size_t element)
 {
-  if (sum <= std::numeric_limits< size_t >::max() - *it)
+  out << element;
+  if (sum <= std::numeric_limits< size_t >::max() - element)
   {
-    sum += *it;
-    it_out->second.pop_front();
+    sum += element;
   }
   else
   {
@@ -170,7 +267,7 @@ void petrov::addElementToSumAndPopFrontIt(size_t & sum, list_it_t it_out, sublis
   }
 }
 
-std::ostream & petrov::outputSums(std::ostream & out, const result_list_type sums)
+std::ostream & petrov::outputSums(std::ostream & out, const result_list_type & sums)
 {
   if (sums.size() == 1)
   {
@@ -188,4 +285,3 @@ std::ostream & petrov::outputSums(std::ostream & out, const result_list_type sum
   }
   return out;
 }
-
@@ -1,6 +1,11 @@
 #include <boost/test/unit_test.hpp>
 #include <boost/test/execution_monitor.hpp>
 #include <sstream>
+#include <vector>
+#include <random>
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
 #include "forward_ring_list.hpp"
 
 BOOST_AUTO_TEST_SUITE(forward_ring_list_iterator)
@@ -3186,6 +3191,119 @@ BOOST_AUTO_TEST_CASE(sort_sorted_3)
 BOOST_AUTO_TEST_SUITE_END()
 
 
+BOOST_AUTO_TEST_SUITE(sort_relink)
+
+BOOST_AUTO_TEST_CASE(sort_stable)
+{
+  std::ostringstream out;
+  petrov::ForwardRingList< std::pair< int, char > > fwd_list { { 2, 'a' }, { 1, 'b' }, { 2, 'c' }, { 1, 'd' }, { 2, 'e' } };
+  fwd_list.sort([](const std::pair< int, char > & lhs, const std::pair< int, char > & rhs)
+  {
+    return lhs.first < rhs.first;
+  });
+  auto it = fwd_list.cbegin();
+  for (size_t i = 0; i < fwd_list.size(); i++)
+  {
+    out << (it++)->second << " ";
+  }
+  out << it->second;
+  BOOST_TEST(out.str() == "b d a c e b");
+}
+
+BOOST_AUTO_TEST_CASE(sort_keeps_nodes)
+{
+  petrov::ForwardRingList< int > fwd_list { 5, 3, 9, 1, 7 };
+  std::vector< const int * > before;
+  for (auto it = fwd_list.cbegin(); before.size() < fwd_list.size(); ++it)
+  {
+    before.push_back(&*it);
+  }
+  fwd_list.sort();
+  std::vector< const int * > after;
+  for (auto it = fwd_list.cbegin(); after.size() < fwd_list.size(); ++it)
+  {
+    after.push_back(&*it);
+  }
+  std::sort(before.begin(), before.end());
+  std::sort(after.begin(), after.end());
+  BOOST_TEST(before == after);
+}
+
+BOOST_AUTO_TEST_CASE(sort_random)
+{
+  std::mt19937 gen(42);
+  std::uniform_int_distribution< int > dist(0, 1000);
+  std::vector< int > expected;
+  petrov::ForwardRingList< int > fwd_list;
+  for (int i = 0; i < 10000; i++)
+  {
+    int value = dist(gen);
+    expected.push_back(value);
+    fwd_list.push_front(value);
+  }
+  std::sort(expected.begin(), expected.end());
+  fwd_list.sort();
+  std::vector< int > result;
+  auto it = fwd_list.cbegin();
+  for (size_t i = 0; i < fwd_list.size(); i++)
+  {
+    result.push_back(*(it++));
+  }
+  BOOST_TEST(result == expected);
+  BOOST_TEST(*it == expected.front());
+}
+
+BOOST_AUTO_TEST_CASE(sort_large_reversed)
+{
+  const int count = 1000000;
+  petrov::ForwardRingList< int > fwd_list;
+  for (int i = 0; i < count; i++)
+  {
+    fwd_list.push_front(i);
+  }
+  fwd_list.sort();
+  bool ordered = true;
+  auto it = fwd_list.cbegin();
+  for (int i = 0; i < count; i++)
+  {
+    ordered = ordered && *(it++) == i;
+  }
+  BOOST_TEST(ordered);
+  BOOST_TEST(*it == 0);
+}
+
+BOOST_AUTO_TEST_CASE(sort_throwing_comp)
+{
+  std::ostringstream out;
+  petrov::ForwardRingList< int > fwd_list { 8, 5, 6, 9, 2, 3, 8, 6, 2, 6 };
+  size_t calls = 0;
+  auto comp = [&calls](int lhs, int rhs)
+  {
+    if (++calls == 12)
+    {
+      throw std::logic_error("comp");
+    }
+    return lhs < rhs;
+  };
+  BOOST_CHECK_THROW(fwd_list.sort(comp), std::logic_error);
+  std::vector< int > result;
+  auto it = fwd_list.cbegin();
+  for (size_t i = 0; i < fwd_list.size(); i++)
+  {
+    result.push_back(*(it++));
+  }
+  std::sort(result.begin(), result.end());
+  for (size_t i = 0; i < result.size(); i++)
+  {
+    out << result[i] << " ";
+  }
+  out << (it == fwd_list.cbegin());
+  BOOST_TEST(out.str() == "2 2 3 5 6 6 6 8 8 9 1");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
 BOOST_AUTO_TEST_SUITE(merge_method)
 
 BOOST_AUTO_TEST_CASE(merge_empty)
@@ -102,6 +102,7 @@ std::istream & petrov::inputDatasets(std::istream & input, maintree_t & tree)
       continue;
     }
     std::pair< int, std::string > data;
+    subtree_t::const_it_t hint = subtree.cend();
     while (input)
     {
       input >> data.first;
@@ -111,7 +112,7 @@ std::istream & petrov::inputDatasets(std::istream & input, maintree_t & tree)
         input.clear();
         break;
       }
-      subtree.insert({ data.first, data.second });
+      hint = subtree.emplace_hint(hint, data.first, data.second);
     }
     tree.insert({ dataset, subtree });
   }
@@ -1217,6 +1217,52 @@ BOOST_AUTO_TEST_CASE(emplace_hint_begin)
   BOOST_TEST(out.str() == "0 1 2 3 4 5 6 7 8 9 10");
 }
 
+BOOST_AUTO_TEST_CASE(emplace_hint_previous_result)
+{
+  std::ostringstream out;
+  petrov::AVLTree< int, char > tree;
+  petrov::AVLTree< int, char >::const_it_t hint = tree.cend();
+  for (int i = 0; i < 10; ++i)
+  {
+    hint = tree.emplace_hint(hint, i, 'a');
+  }
+  for (auto it = tree.cbegin(); it != tree.cend(); ++it)
+  {
+    out << it->first << " ";
+  }
+  out << tree.size() << " " << tree.crbegin()->first;
+  BOOST_TEST(out.str() == "0 1 2 3 4 5 6 7 8 9 10 9");
+}
+
+BOOST_AUTO_TEST_CASE(emplace_hint_far_from_key)
+{
+  std::ostringstream out;
+  petrov::AVLTree< int, int > tree;
+  for (int i = 0; i < 40; i += 4)
+  {
+    tree.emplace_hint(tree.cend(), i, i);
+  }
+  tree.emplace_hint(tree.cbegin(), 37, 37);
+  tree.emplace_hint(tree.cend(), 1, 1);
+  tree.emplace_hint(tree.find(20), 21, 21);
+  tree.emplace_hint(tree.find(20), 18, 18);
+  for (auto it = tree.cbegin(); it != tree.cend(); ++it)
+  {
+    out << it->first << " ";
+  }
+  out << tree.size();
+  BOOST_TEST(out.str() == "0 1 4 8 12 16 18 20 21 24 28 32 36 37 14");
+}
+
+BOOST_AUTO_TEST_CASE(emplace_hint_existing_key)
+{
+  std::ostringstream out;
+  petrov::AVLTree< int, int > tree { { 1, 1 }, { 2, 2 }, { 3, 3 } };
+  auto ret_it = tree.emplace_hint(tree.cend(), 2, 5);
+  out << ret_it->first << " " << ret_it->second << " " << tree.size();
+  BOOST_TEST(out.str() == "2 2 3");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
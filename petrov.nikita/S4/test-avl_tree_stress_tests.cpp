@@ -44,6 +44,51 @@ BOOST_AUTO_TEST_CASE(stress_test_3)
   BOOST_TEST(out.str() == "1");
 }
 
+BOOST_AUTO_TEST_CASE(hinted_sorted_stress_test)
+{
+  std::ostringstream out;
+  petrov::AVLTree< int, int > tree;
+  petrov::AVLTree< int, int >::const_it_t hint = tree.cend();
+  for (int i = 0; i < 1000000; ++i)
+  {
+    hint = tree.emplace_hint(hint, i, i);
+  }
+  int expected = 0;
+  bool ordered = true;
+  for (auto it = tree.cbegin(); it != tree.cend(); ++it)
+  {
+    ordered = ordered && it->first == expected++;
+  }
+  out << ordered << " " << tree.size();
+  BOOST_TEST(out.str() == "1 1000000");
+}
+
+BOOST_AUTO_TEST_CASE(hinted_random_stress_test)
+{
+  std::mt19937 gen(7);
+  std::uniform_int_distribution< int > dist(0, 100000);
+  petrov::AVLTree< int, int > tree;
+  petrov::AVLTree< int, int > hinted;
+  petrov::AVLTree< int, int >::const_it_t hint = hinted.cend();
+  for (int i = 0; i < 100000; ++i)
+  {
+    int key = (i % 1000 < 500) ? dist(gen) : i;
+    tree.insert({ key, i });
+    if (i % 3 == 0)
+    {
+      hint = hinted.cbegin();
+    }
+    hint = hinted.emplace_hint(hint, key, i);
+  }
+  bool same = tree.size() == hinted.size();
+  auto hinted_it = hinted.cbegin();
+  for (auto it = tree.cbegin(); same && it != tree.cend(); ++it, ++hinted_it)
+  {
+    same = it->first == hinted_it->first && it->second == hinted_it->second;
+  }
+  BOOST_TEST(same);
+}
+
 BOOST_AUTO_TEST_CASE(stress_test_7)
 {
   std::ostringstream out;
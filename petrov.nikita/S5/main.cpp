@@ -31,13 +31,14 @@ int main(const int argc, const char * const * argv)
   }
   AVLTree< long long, std::string > tree;
   std::ifstream in(argv[2]);
+  AVLTree< long long, std::string >::const_it_t hint = tree.cend();
   while (!in.eof())
   {
     long long key = 0;
     std::string val;
     if (in >> key >> val)
     {
-      tree.insert({ key, val });
+      hint = tree.emplace_hint(hint, key, val);
     }
   }
   SumUpKeysDisplayValues sum_and_display;
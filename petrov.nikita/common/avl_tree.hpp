@@ -30,6 +30,9 @@ namespace petrov
     void setHeight();
   };
 
+  template< typename K, typename T, typename Cmp >
+  struct AVLTreeIterator;
+
   template< typename K, typename T, typename Cmp = std::less< K > >
   struct ConstAVLTreeIterator: std::iterator< std::bidirectional_iterator_tag, T >
   {
@@ -41,6 +44,7 @@ namespace petrov
     using this_t = ConstAVLTreeIterator< K, T, Cmp >;
     ConstAVLTreeIterator();
     ConstAVLTreeIterator(const this_t & rhs) = default;
+    ConstAVLTreeIterator(const AVLTreeIterator< K, T, Cmp > & rhs);
     ~ConstAVLTreeIterator() = default;
     this_t & operator=(const this_t & rhs) = default;
     this_t & operator++();
@@ -61,6 +65,7 @@ namespace petrov
   {
     template< typename A, typename B, typename C >
     friend struct AVLTree;
+    friend struct ConstAVLTreeIterator< K, T, Cmp >;
   public:
     using val_t = std::pair< const K, T >;
     using node_t = AVLTreeNode< K, T >;
@@ -164,6 +169,8 @@ namespace petrov
     F traverse_breadth(F f) const;
   private:
     node_t * root_;
+    node_t * leftmost_;
+    node_t * rightmost_;
     size_t size_;
     void balance(node_t * node);
     void leftRotate(node_t * node);
@@ -174,6 +181,13 @@ namespace petrov
     InputIterator findIf(InputIterator first, InputIterator last, const K & key, UnPred p) const;
     void deepRotation(node_t * node);
     void upwardBalancing(node_t * node);
+    void updateChildrenHeights(node_t * node);
+    void insertBalancing(node_t * node);
+    void attachLeaf(node_t * parent, node_t * added);
+    node_t * hintedParent(node_t * hint, const K & key) const;
+    static node_t * predecessor(node_t * node);
+    static node_t * successor(node_t * node);
+    node_t * descendToParent(node_t * subroot, const K & key) const;
     void eraseImpl(node_t * node);
     template< class... Args >
     std::pair< it_t, bool > emplaceImpl(node_t * subroot, Args && ... args);
@@ -317,6 +331,11 @@ namespace petrov
     return !(*this == rhs);
   }
 
+  template< typename K, typename T, typename Cmp >
+  ConstAVLTreeIterator< K, T, Cmp >::ConstAVLTreeIterator(const AVLTreeIterator< K, T, Cmp > & rhs):
+    node_(rhs.node_)
+  {}
+
   template< typename K, typename T, typename Cmp >
   ConstAVLTreeIterator< K, T, Cmp >::ConstAVLTreeIterator(node_t * node):
     node_(node)
@@ -433,12 +452,16 @@ namespace petrov
   template< typename K, typename T, typename Cmp >
   AVLTree< K, T, Cmp >::AVLTree():
     root_(nullptr),
+    leftmost_(nullptr),
+    rightmost_(nullptr),
     size_(0)
   {}
 
   template< typename K, typename T, typename Cmp >
   AVLTree< K, T, Cmp >::AVLTree(const this_t & rhs):
     root_(nullptr),
+    leftmost_(nullptr),
+    rightmost_(nullptr),
     size_(0)
   {
     try
@@ -455,15 +478,21 @@ namespace petrov
   template< typename K, typename T, typename Cmp >
   AVLTree< K, T, Cmp >::AVLTree(this_t && rhs):
     root_(rhs.root_),
+    leftmost_(rhs.leftmost_),
+    rightmost_(rhs.rightmost_),
     size_(rhs.size_)
   {
     rhs.root_ = nullptr;
+    rhs.leftmost_ = nullptr;
+    rhs.rightmost_ = nullptr;
   }
 
   template< typename K, typename T, typename Cmp >
   template< class InputIterator >
   AVLTree< K, T, Cmp >::AVLTree(InputIterator first, InputIterator last):
     root_(nullptr),
+    leftmost_(nullptr),
+    rightmost_(nullptr),
     size_(0)
   {
     try
@@ -501,8 +530,12 @@ namespace petrov
   {
     clear();
     root_ = rhs.root_;
+    leftmost_ = rhs.leftmost_;
+    rightmost_ = rhs.rightmost_;
     size_ = rhs.size_;
     rhs.root_ = nullptr;
+    rhs.leftmost_ = nullptr;
+    rhs.rightmost_ = nullptr;
     return *this;
   }
 
@@ -521,19 +554,7 @@ namespace petrov
   template< typename K, typename T, typename Cmp >
   typename AVLTree< K, T, Cmp >::const_it_t AVLTree< K, T, Cmp >::cbegin() const
   {
-    auto temp = root_;
-    if (empty())
-    {
-      return const_it_t();
-    }
-    else
-    {
-      while (temp->left)
-      {
-        temp = temp->left;
-      }
-    }
-    return const_it_t(temp);
+    return const_it_t(leftmost_);
   }
 
   template< typename K, typename T, typename Cmp >
@@ -545,19 +566,7 @@ namespace petrov
   template< typename K, typename T, typename Cmp >
   typename AVLTree< K, T, Cmp >::it_t AVLTree< K, T, Cmp >::begin()
   {
-    auto temp = root_;
-    if (empty())
-    {
-      return it_t();
-    }
-    else
-    {
-      while (temp->left)
-      {
-        temp = temp->left;
-      }
-    }
-    return it_t(temp);
+    return it_t(leftmost_);
   }
 
   template< typename K, typename T, typename Cmp >
@@ -569,19 +578,7 @@ namespace petrov
   template< typename K, typename T, typename Cmp >
   typename AVLTree< K, T, Cmp >::const_it_t AVLTree< K, T, Cmp >::crbegin() const
   {
-    auto temp = root_;
-    if (empty())
-    {
-      return const_it_t();
-    }
-    else
-    {
-      while (temp->right)
-      {
-        temp = temp->right;
-      }
-    }
-    return const_it_t(temp);
+    return const_it_t(rightmost_);
   }
 
   template< typename K, typename T, typename Cmp >
@@ -593,19 +590,7 @@ namespace petrov
   template< typename K, typename T, typename Cmp >
   typename AVLTree< K, T, Cmp >::it_t AVLTree< K, T, Cmp >::rbegin()
   {
-    auto temp = root_;
-    if (empty())
-    {
-      return it_t();
-    }
-    else
-    {
-      while (temp->right)
-      {
-        temp = temp->right;
-      }
-    }
-    return it_t(temp);
+    return it_t(rightmost_);
   }
 
   template< typename K, typename T, typename Cmp >
@@ -667,64 +652,26 @@ namespace petrov
   {
     if (empty())
     {
-      root_ = new node_t{ nullptr, nullptr, nullptr, std::forward< Args >(args)... };
-      size_++;
-      return it_t(root_);
+      return emplaceImpl(root_, std::forward< Args >(args)...).first;
     }
-    std::pair< it_t, bool > ret_val;
-    node_t * added = nullptr;
+    node_t * added = new node_t{ nullptr, nullptr, nullptr, std::forward< Args >(args)... };
+    node_t * parent = nullptr;
     try
     {
-      added = new node_t{ nullptr, nullptr, nullptr, std::forward< Args >(args)... };
-      auto begin = cbegin();
-      if (hint == begin)
-      {
-        hint = begin;
-        if (Cmp{}(added->data.first, hint.node_->data.first))
-        {
-          hint.node_->left = added;
-          added->parent = hint.node_;
-          size_++;
-          upwardBalancing(added->parent);
-          return it_t(added);
-        }
-      }
-      else if (hint == cend())
-      {
-        hint = crbegin();
-        if (Cmp{}(hint.node_->data.first, added->data.first))
-        {
-          hint.node_->right = added;
-          added->parent = hint.node_;
-          size_++;
-          upwardBalancing(added->parent);
-          return it_t(added);
-        }
-      }
-      if (!Cmp{}(added->data.first, hint.node_->data.first))
-      {
-        delete added;
-        ret_val = emplace(std::forward< Args >(args)...);
-      }
-      else
-      {
-        for (auto it = hint; it != crend(); --it)
-        {
-          if (!Cmp{}(added->data.first, it.node_->data.first))
-          {
-            delete added;
-            ret_val = emplaceImpl(it.node_, std::forward< Args >(args)...);
-            break;
-          }
-        }
-      }
+      parent = hintedParent(hint.node_, added->data.first);
     }
     catch (...)
     {
       delete added;
       throw;
     }
-    return ret_val.first;
+    if (!Cmp{}(added->data.first, parent->data.first) && !Cmp{}(parent->data.first, added->data.first))
+    {
+      delete added;
+      return it_t(parent);
+    }
+    attachLeaf(parent, added);
+    return it_t(added);
   }
 
   template< typename K, typename T, typename Cmp >
@@ -901,12 +848,16 @@ namespace petrov
       }
       root_ = nullptr;
     }
+    leftmost_ = nullptr;
+    rightmost_ = nullptr;
   }
 
   template< typename K, typename T, typename Cmp >
   void AVLTree< K, T, Cmp >::swap(this_t & rhs) noexcept
   {
     std::swap(root_, rhs.root_);
+    std::swap(leftmost_, rhs.leftmost_);
+    std::swap(rightmost_, rhs.rightmost_);
     std::swap(size_, rhs.size_);
   }
 
@@ -1264,14 +1215,36 @@ namespace petrov
       {
         balance(node);
         node->setHeight();
+        updateChildrenHeights(node->parent);
       }
       node = node->parent;
     }
   }
 
+  template< typename K, typename T, typename Cmp >
+  void AVLTree< K, T, Cmp >::updateChildrenHeights(node_t * node)
+  {
+    if (node->left)
+    {
+      node->left->setHeight();
+    }
+    if (node->right)
+    {
+      node->right->setHeight();
+    }
+  }
+
   template< typename K, typename T, typename Cmp >
   void AVLTree< K, T, Cmp >::eraseImpl(node_t * node)
   {
+    if (node == leftmost_)
+    {
+      leftmost_ = (++const_it_t(node)).node_;
+    }
+    if (node == rightmost_)
+    {
+      rightmost_ = (--const_it_t(node)).node_;
+    }
     node_t * balance_node_ptr = nullptr;
     auto temp = node;
     if (node->left)
@@ -1350,57 +1323,209 @@ namespace petrov
     if (empty())
     {
       root_ = new node_t{ nullptr, nullptr, nullptr, std::forward< Args >(args)... };
+      leftmost_ = root_;
+      rightmost_ = root_;
       size_++;
       return std::make_pair< it_t, bool >(it_t(root_), true);
     }
-    node_t * added = nullptr;
+    node_t * added = new node_t{ nullptr, nullptr, nullptr, std::forward< Args >(args)... };
+    node_t * parent = nullptr;
     try
     {
-      added = new node_t{ nullptr, nullptr, nullptr, std::forward< Args >(args)... };
-      auto temp = subroot;
-      while (temp->left || temp->right)
+      parent = descendToParent(subroot, added->data.first);
+    }
+    catch (...)
+    {
+      delete added;
+      throw;
+    }
+    if (!Cmp{}(added->data.first, parent->data.first) && !Cmp{}(parent->data.first, added->data.first))
+    {
+      delete added;
+      return std::make_pair< it_t, bool >(it_t(parent), false);
+    }
+    attachLeaf(parent, added);
+    return std::make_pair< it_t, bool >(it_t(added), true);
+  }
+
+  template< typename K, typename T, typename Cmp >
+  void AVLTree< K, T, Cmp >::attachLeaf(node_t * parent, node_t * added)
+  {
+    if (Cmp{}(added->data.first, parent->data.first))
+    {
+      parent->left = added;
+      if (parent == leftmost_)
       {
-        if (temp->left && Cmp{}(added->data.first, temp->data.first))
-        {
-          temp = temp->left;
-        }
-        else if (temp->right && Cmp{}(temp->data.first, added->data.first))
-        {
-          temp = temp->right;
-        }
-        else if (!Cmp{}(added->data.first, temp->data.first) && !Cmp{}(temp->data.first, added->data.first))
-        {
-          delete added;
-          return std::make_pair< it_t, bool >(it_t(temp), false);
-        }
-        else
-        {
-          break;
-        }
+        leftmost_ = added;
       }
-      if (Cmp{}(added->data.first, temp->data.first))
+    }
+    else
+    {
+      parent->right = added;
+      if (parent == rightmost_)
       {
-        temp->left = added;
+        rightmost_ = added;
       }
-      else if (Cmp{}(temp->data.first, added->data.first))
+    }
+    added->parent = parent;
+    size_++;
+    insertBalancing(parent);
+  }
+
+  template< typename K, typename T, typename Cmp >
+  void AVLTree< K, T, Cmp >::insertBalancing(node_t * node)
+  {
+    while (node)
+    {
+      int old_height = node->height_;
+      node->setHeight();
+      if (!isBalanced(node))
       {
-        temp->right = added;
+        balance(node);
+        node->setHeight();
+        updateChildrenHeights(node->parent);
+        node = node->parent;
+        node->setHeight();
       }
-      else if (!Cmp{}(added->data.first, temp->data.first) && !Cmp{}(temp->data.first, added->data.first))
+      if (node->height_ == old_height)
       {
-        delete added;
-        return std::make_pair< it_t, bool >(it_t(temp), false);
+        break;
       }
-      added->parent = temp;
-      size_++;
-      upwardBalancing(temp);
+      node = node->parent;
     }
-    catch (...)
+  }
+
+  template< typename K, typename T, typename Cmp >
+  typename AVLTree< K, T, Cmp >::node_t * AVLTree< K, T, Cmp >::hintedParent(node_t * hint, const K & key) const
+  {
+    node_t * prev = nullptr;
+    node_t * next = nullptr;
+    if (!hint || Cmp{}(key, hint->data.first))
     {
-      delete added;
-      throw;
+      next = hint;
+      if (!hint)
+      {
+        prev = rightmost_;
+      }
+      else if (hint != leftmost_)
+      {
+        prev = predecessor(hint);
+      }
+      if (!prev || Cmp{}(prev->data.first, key))
+      {
+        return (next && !next->left) ? next : prev;
+      }
+      hint = prev;
+    }
+    else if (Cmp{}(hint->data.first, key))
+    {
+      prev = hint;
+      if (hint != rightmost_)
+      {
+        next = successor(hint);
+      }
+      if (!next || Cmp{}(key, next->data.first))
+      {
+        return prev->right ? next : prev;
+      }
+      hint = next;
+    }
+    else
+    {
+      return hint;
+    }
+    bool less = Cmp{}(key, hint->data.first);
+    if (!less && !Cmp{}(hint->data.first, key))
+    {
+      return hint;
+    }
+    int climb_limit = (root_->height_ + hint->height_) / 2;
+    node_t * subroot = hint;
+    while (subroot->parent && subroot->parent->height_ <= climb_limit)
+    {
+      node_t * parent = subroot->parent;
+      bool covers = false;
+      if (less)
+      {
+        covers = parent->right == subroot && Cmp{}(parent->data.first, key);
+      }
+      else
+      {
+        covers = parent->left == subroot && Cmp{}(key, parent->data.first);
+      }
+      if (covers)
+      {
+        return descendToParent(subroot, key);
+      }
+      subroot = parent;
+    }
+    return descendToParent(root_, key);
+  }
+
+  template< typename K, typename T, typename Cmp >
+  typename AVLTree< K, T, Cmp >::node_t * AVLTree< K, T, Cmp >::predecessor(node_t * node)
+  {
+    if (node->left)
+    {
+      node = node->left;
+      while (node->right)
+      {
+        node = node->right;
+      }
+      return node;
+    }
+    while (node->parent && node->parent->left == node)
+    {
+      node = node->parent;
+    }
+    return node->parent;
+  }
+
+  template< typename K, typename T, typename Cmp >
+  typename AVLTree< K, T, Cmp >::node_t * AVLTree< K, T, Cmp >::successor(node_t * node)
+  {
+    if (node->right)
+    {
+      node = node->right;
+      while (node->left)
+      {
+        node = node->left;
+      }
+      return node;
+    }
+    while (node->parent && node->parent->right == node)
+    {
+      node = node->parent;
+    }
+    return node->parent;
+  }
+
+  template< typename K, typename T, typename Cmp >
+  typename AVLTree< K, T, Cmp >::node_t * AVLTree< K, T, Cmp >::descendToParent(node_t * subroot, const K & key) const
+  {
+    while (true)
+    {
+      if (Cmp{}(key, subroot->data.first))
+      {
+        if (!subroot->left)
+        {
+          return subroot;
+        }
+        subroot = subroot->left;
+      }
+      else if (Cmp{}(subroot->data.first, key))
+      {
+        if (!subroot->right)
+        {
+          return subroot;
+        }
+        subroot = subroot->right;
+      }
+      else
+      {
+        return subroot;
+      }
     }
-    return std::make_pair< it_t, bool >(it_t(added), true);
   }
 }
 
@@ -0,0 +1,27 @@
+#include "include_cache.hpp"
+
+#include <functional>
+
+bool rychkov::operator==(const LineState& lhs, const LineState& rhs) noexcept
+{
+  return (lhs.prev == rhs.prev) && (lhs.screened == rhs.screened) && (lhs.empty_line == rhs.empty_line);
+}
+
+bool rychkov::IncludeCache::find(const std::string& text, IncludeGuard& guard) const
+{
+  size_t hash = std::hash< std::string >{}(text);
+  std::lock_guard< std::mutex > lock(mutex_);
+  decltype(guards_)::const_iterator guard_p = guards_.find(hash);
+  if ((guard_p == guards_.cend()) || (guard_p->second.first != text))
+  {
+    return false;
+  }
+  guard = guard_p->second.second;
+  return true;
+}
+void rychkov::IncludeCache::insert(std::string text, IncludeGuard guard)
+{
+  size_t hash = std::hash< std::string >{}(text);
+  std::lock_guard< std::mutex > lock(mutex_);
+  guards_.emplace(hash, std::make_pair(std::move(text), std::move(guard)));
+}
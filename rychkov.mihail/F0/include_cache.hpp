@@ -0,0 +1,40 @@
+#ifndef INCLUDE_CACHE_HPP
+#define INCLUDE_CACHE_HPP
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <mutex>
+#include <map.hpp>
+
+namespace rychkov
+{
+  struct LineState
+  {
+    char prev = '\0';
+    bool screened = false;
+    bool empty_line = true;
+  };
+  bool operator==(const LineState& lhs, const LineState& rhs) noexcept;
+
+  struct IncludeGuard
+  {
+    std::string macro;
+    std::string whitespaces;
+    LineState entry;
+    LineState exit;
+  };
+
+  class IncludeCache
+  {
+  public:
+    bool find(const std::string& text, IncludeGuard& guard) const;
+    void insert(std::string text, IncludeGuard guard);
+
+  private:
+    mutable std::mutex mutex_;
+    Map< size_t, std::pair< std::string, IncludeGuard > > guards_;
+  };
+}
+
+#endif
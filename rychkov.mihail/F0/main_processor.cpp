@@ -26,19 +26,23 @@ rychkov::Parser::map_type< rychkov::MainProcessor > rychkov::MainProcessor::call
     };
 
 rychkov::ParseCell::ParseCell(CParseContext context, Stage last_stage,
-    std::vector< std::string > include_dirs):
+    std::vector< std::string > include_dirs, std::shared_ptr< IncludeCache > include_cache):
   base_context{std::move(context)},
   preproc{std::unique_ptr< Lexer >{last_stage == PREPROCESSOR ? nullptr : new Lexer
         {std::unique_ptr< CParser >{last_stage != CPARSER ? nullptr : new CParser{}}}},
-      std::move(include_dirs)}
+      std::move(include_dirs), std::move(include_cache)}
 {}
 bool rychkov::ParseCell::parse(std::istream& in)
+{
+  return parse(in, base_context);
+}
+bool rychkov::ParseCell::parse(std::istream& in, CParseContext& context)
 {
   std::stringstream cache_stream;
   cache_stream << in.rdbuf();
   cache = cache_stream.str();
-  preproc.parse(base_context, cache_stream);
-  return base_context.nerrors == 0;
+  preproc.parse(context, cache_stream);
+  return context.nerrors == 0;
 }
 
 bool rychkov::MainProcessor::parse(ParserContext& context)
@@ -54,7 +58,7 @@ bool rychkov::MainProcessor::parse(ParserContext& context)
     context.err << "failed to open file\n";
     return true;
   }
-  ParseCell cell = {{context.out, context.err, filename}, last_stage_, include_dirs_};
+  ParseCell cell = {{context.out, context.err, filename}, last_stage_, include_dirs_, include_cache_};
   context.out << "<--PARSE: \"" << filename << "\"-->\n";
   if (!cell.parse(in))
   {
@@ -85,7 +89,7 @@ bool rychkov::MainProcessor::reload(ParserContext& context)
       context.err << "failed to reopen source file: \"" << file.first << "\"\n";
     }
     std::pair< decltype(new_parsed)::iterator, bool > cell_p = new_parsed.emplace(file.first,
-          ParseCell{{context.out, context.err, file.first}, last_stage_, include_dirs_});
+          ParseCell{{context.out, context.err, file.first}, last_stage_, include_dirs_, include_cache_});
     if (cell_p.second)
     {
       context.out << "<--PARSE: \"" << file.first << "\"-->\n";
@@ -104,7 +108,7 @@ bool rychkov::MainProcessor::reload(ParserContext& context)
 bool rychkov::MainProcessor::parse_after(ParserContext& context)
 {
   std::string generated_name = "untitled_" + std::to_string(generated_files + 1);
-  ParseCell cell = {{context.out, context.err, generated_name}, last_stage_, include_dirs_};
+  ParseCell cell = {{context.out, context.err, generated_name}, last_stage_, include_dirs_, include_cache_};
   cell.real_file = false;
   if (!eol(context.in))
   {
@@ -217,7 +221,7 @@ bool rychkov::MainProcessor::unopen_defines(ParserContext& context)
   }
   std::istringstream in(cell.cache);
   std::stringstream preprocessed;
-  Preprocessor preproc{nullptr, include_dirs_};
+  Preprocessor preproc{nullptr, include_dirs_, include_cache_};
   CParseContext parse_context{preprocessed, context.err, cell.base_context.file};
   preproc.parse(parse_context, in);
   std::string line;
@@ -2,8 +2,11 @@
 #define PROCESSORS_HPP
 
 #include <iosfwd>
+#include <sstream>
 #include <string>
 #include <vector>
+#include <memory>
+#include <exception>
 
 #include <map.hpp>
 #include <parser.hpp>
@@ -21,14 +24,26 @@ namespace rychkov
   };
   struct ParseCell
   {
-    ParseCell(CParseContext context, Stage last_stage, std::vector< std::string > include_dirs);
+    ParseCell(CParseContext context, Stage last_stage, std::vector< std::string > include_dirs,
+        std::shared_ptr< IncludeCache > include_cache);
     bool parse(std::istream& in);
+    bool parse(std::istream& in, CParseContext& context);
     CParseContext base_context;
     Preprocessor preproc;
     bool real_file = true;
     std::string cache;
   };
 
+  struct ParseTask
+  {
+    std::string file;
+    std::ostringstream out;
+    std::ostringstream err;
+    std::unique_ptr< ParseCell > cell;
+    std::exception_ptr error;
+    bool success = false;
+  };
+
   class MainProcessor
   {
   public:
@@ -63,8 +78,12 @@ namespace rychkov
     Stage last_stage_ = CPARSER;
     std::vector< std::string > include_dirs_;
     Map< std::string, ParseCell > parsed_;
+    std::shared_ptr< IncludeCache > include_cache_ = std::make_shared< IncludeCache >();
     std::string save_file_ = "save.json";
     size_t generated_files = 0;
+
+    void parse_parallel(ParserContext& context, std::vector< ParseTask >& tasks, size_t jobs) const;
+    bool merge(CParseContext file_context, ParseTask& task);
   };
 }
 
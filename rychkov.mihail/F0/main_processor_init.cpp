@@ -5,6 +5,9 @@
 #include <utility>
 #include <stdexcept>
 #include <algorithm>
+#include <atomic>
+#include <thread>
+#include <system_error>
 #include <algorithm.hpp>
 
 using namespace std::literals::string_literals;
@@ -13,6 +16,7 @@ bool rychkov::MainProcessor::init(ParserContext& context, int argc, char** argv)
 {
   bool sources = false;
   bool out = false;
+  size_t jobs = 1;
   std::vector< std::string > files;
   for (int i = 1; i < argc; i++)
   {
@@ -64,6 +68,15 @@ bool rychkov::MainProcessor::init(ParserContext& context, int argc, char** argv)
       }
       out = true;
     }
+    else if (std::strcmp(argv[i], "-j") == 0)
+    {
+      sources = false;
+      if (++i >= argc)
+      {
+        throw std::invalid_argument("missing number of jobs");
+      }
+      jobs = std::stoul(argv[i]);
+    }
     else if (std::strcmp(argv[i], "-I") == 0)
     {
       sources = false;
@@ -86,9 +99,21 @@ bool rychkov::MainProcessor::init(ParserContext& context, int argc, char** argv)
   std::sort(files.begin(), files.end());
   files.erase(rychkov::unique(files.begin(), files.end()), files.end());
 
+  std::vector< ParseTask > tasks;
+  if (jobs != 1)
+  {
+    tasks.resize(files.size());
+    for (size_t i = 0; i < files.size(); i++)
+    {
+      tasks[i].file = files[i];
+    }
+    parse_parallel(context, tasks, jobs == 0 ? std::thread::hardware_concurrency() : jobs);
+  }
+
   std::string ext = (last_stage_ == PREPROCESSOR ? ".i" : (last_stage_ == LEXER ? ".lex" : ".json"));
-  for (const std::string& filename: files)
+  for (size_t i = 0; i < files.size(); i++)
   {
+    const std::string& filename = files[i];
     std::ostream* output = &context.out;
     std::ofstream ostream;
     std::string output_filename;
@@ -113,7 +138,7 @@ bool rychkov::MainProcessor::init(ParserContext& context, int argc, char** argv)
     }
     CParseContext parse_context{*output, context.err, filename};
     context.out << "<--PARSE: \"" << filename << "\"-->\n";
-    if (!parse(parse_context, true))
+    if (!(tasks.empty() ? parse(parse_context, true) : merge(parse_context, tasks[i])))
     {
       throw std::runtime_error("failed to parse file \"" + filename + "\" - stopping");
     }
@@ -134,7 +159,7 @@ bool rychkov::MainProcessor::parse(CParseContext file_context, bool overwrite)
     parsed_.erase(file_context.file);
   }
   std::pair< decltype(parsed_)::iterator, bool > cell = parsed_.emplace(file_context.file,
-    ParseCell{file_context, last_stage_, include_dirs_});
+    ParseCell{file_context, last_stage_, include_dirs_, include_cache_});
   if (!cell.second)
   {
     return true;
@@ -146,3 +171,60 @@ bool rychkov::MainProcessor::parse(CParseContext file_context, bool overwrite)
   }
   return cell.first->second.parse(in);
 }
+void rychkov::MainProcessor::parse_parallel(ParserContext& context, std::vector< ParseTask >& tasks,
+    size_t jobs) const
+{
+  std::atomic< size_t > next_task{0};
+  auto worker = [this, &context, &tasks, &next_task]()
+  {
+    for (size_t i = next_task++; i < tasks.size(); i = next_task++)
+    {
+      ParseTask& task = tasks[i];
+      try
+      {
+        std::ifstream in(task.file);
+        if (!in)
+        {
+          throw std::invalid_argument("failed to open source file: \"" + task.file + '"');
+        }
+        task.cell.reset(new ParseCell{{context.out, context.err, task.file}, last_stage_, include_dirs_,
+              include_cache_});
+        CParseContext task_context{task.out, task.err, task.file};
+        task.success = task.cell->parse(in, task_context);
+      }
+      catch (...)
+      {
+        task.error = std::current_exception();
+      }
+    }
+  };
+  std::vector< std::thread > workers;
+  for (size_t i = 1; (i < jobs) && (i < tasks.size()); i++)
+  {
+    try
+    {
+      workers.emplace_back(worker);
+    }
+    catch (const std::system_error&)
+    {
+      break;
+    }
+  }
+  worker();
+  for (std::thread& thread: workers)
+  {
+    thread.join();
+  }
+}
+bool rychkov::MainProcessor::merge(CParseContext file_context, ParseTask& task)
+{
+  file_context.out << task.out.str();
+  file_context.err << task.err.str();
+  if (task.error != nullptr)
+  {
+    std::rethrow_exception(task.error);
+  }
+  parsed_.erase(task.file);
+  parsed_.emplace(task.file, std::move(*task.cell));
+  return task.success;
+}
@@ -53,7 +53,7 @@ bool rychkov::MainProcessor::load(std::ostream& out, std::ostream& err, std::str
   for (const boost::json::object::value_type& file: doc.as_object())
   {
     std::pair< decltype(new_parsed)::iterator, bool > cell_p = new_parsed.emplace(file.key(),
-          ParseCell{{out, err, file.key()}, last_stage_, include_dirs_});
+          ParseCell{{out, err, file.key()}, last_stage_, include_dirs_, include_cache_});
     if (cell_p.second)
     {
       Preprocessor& preproc = cell_p.first->second.preproc;
@@ -7,11 +7,14 @@
 #include "lexer.hpp"
 
 rychkov::Preprocessor::Preprocessor():
-  next{nullptr}
+  next{nullptr},
+  include_cache{std::make_shared< IncludeCache >()}
 {}
-rychkov::Preprocessor::Preprocessor(std::unique_ptr< Lexer > lexer, std::vector< std::string > search_dirs):
+rychkov::Preprocessor::Preprocessor(std::unique_ptr< Lexer > lexer, std::vector< std::string > search_dirs,
+    std::shared_ptr< IncludeCache > cache):
   include_paths(std::move(search_dirs)),
-  next{std::move(lexer)}
+  next{std::move(lexer)},
+  include_cache{std::move(cache)}
 {}
 
 bool rychkov::Preprocessor::skip_all() const noexcept
@@ -47,6 +50,10 @@ void rychkov::Preprocessor::flush(CParseContext& context, char c)
   }
   else if (!skip_all())
   {
+    if (!guard_scans_.empty())
+    {
+      scan_output(c);
+    }
     if (next == nullptr)
     {
       context.out << c;
@@ -66,6 +73,7 @@ void rychkov::Preprocessor::flush_buf(CParseContext& context)
     std::istringstream in(buf_);
     std::string cmd;
     in >> std::noskipws >> cmd >> std::skipws;
+    size_t depth = conditional_pairs_.size();
     if (!skip_all() || (cmd == "endif") || (cmd == "else"))
     {
       decltype(directives_)::const_iterator cmd_p = directives_.find(cmd);
@@ -78,6 +86,10 @@ void rychkov::Preprocessor::flush_buf(CParseContext& context)
         (this->*(cmd_p->second))(in, context);
       }
     }
+    if (!guard_scans_.empty())
+    {
+      scan_directive(context, cmd, depth);
+    }
     buf_.clear();
     return;
   }
@@ -131,19 +143,23 @@ void rychkov::Preprocessor::flush_buf(CParseContext& context)
         }
         else
         {
+          if (!guard_scans_.empty())
+          {
+            scan_token();
+          }
           switch (prev)
           {
           case rychkov::Preprocessor::STRING_LITERAL:
-            next->append_string_literal(context, buf_);
+            next->append_string_literal(context, std::move(buf_));
             break;
           case rychkov::Preprocessor::CHAR_LITERAL:
-            next->append_char_literal(context, buf_);
+            next->append_char_literal(context, std::move(buf_));
             break;
           case rychkov::Preprocessor::NAME:
-            next->append_name(context, buf_);
+            next->append_name(context, std::move(buf_));
             break;
           case rychkov::Preprocessor::NUMBER:
-            next->append_number(context, buf_);
+            next->append_number(context, std::move(buf_));
             break;
           default:
             for (char c: buf_)
@@ -185,10 +201,17 @@ void rychkov::Preprocessor::parse(CParseContext& context, std::istream& in, bool
     not_first_line = true;
     context.symbol = 0;
     std::getline(in, context.last_line);
-    for (char c: context.last_line)
+    const std::string& line = context.last_line;
+    for (std::string::size_type i = 0; i < line.length();)
     {
-      append(context, c);
-      context.symbol++;
+      std::string::size_type run = append_run(line, i);
+      if (run == 0)
+      {
+        append(context, line[i]);
+        run = 1;
+      }
+      context.symbol += run;
+      i += run;
     }
   }
   if (need_flush)
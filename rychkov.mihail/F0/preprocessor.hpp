@@ -14,6 +14,7 @@
 #include "content.hpp"
 #include "compare.hpp"
 #include "lexer.hpp"
+#include "include_cache.hpp"
 
 namespace rychkov
 {
@@ -24,9 +25,11 @@ namespace rychkov
     std::unique_ptr< Lexer > next;
     Set< Macro, NameCompare > macros;
     MultiSet< Macro, NameCompare > legacy_macros;
+    std::shared_ptr< IncludeCache > include_cache;
 
     Preprocessor();
-    Preprocessor(std::unique_ptr< Lexer > lexer, std::vector< std::string > search_dirs);
+    Preprocessor(std::unique_ptr< Lexer > lexer, std::vector< std::string > search_dirs,
+        std::shared_ptr< IncludeCache > cache = std::make_shared< IncludeCache >());
 
     static std::string get_name(std::istream& in);
     void parse(CParseContext& context, std::istream& in, bool need_flush = true);
@@ -54,6 +57,15 @@ namespace rychkov
       ELSE_BODY,
       SKIP_ELSE
     };
+    struct GuardScan
+    {
+      const CParseContext* file;
+      size_t depth;
+      IncludeGuard guard;
+      bool opened;
+      bool closed;
+      bool valid;
+    };
 
     Map< std::string, void(Preprocessor::*)(std::istream&, CParseContext&) > directives_ = {
           {"include", &rychkov::Preprocessor::include},
@@ -78,12 +90,21 @@ namespace rychkov
 
     std::string buf_;
     rychkov::Stack< IfStage > conditional_pairs_;
+    std::vector< GuardScan > guard_scans_;
 
     static void remove_whitespaces(std::string& str);
     bool skip_all() const noexcept;
     void flush_buf(CParseContext& context);
+    std::string::size_type append_run(const std::string& line, std::string::size_type pos);
     void expanse_macro(CParseContext& context);
 
+    LineState line_state() const noexcept;
+    void restore_line_state(const LineState& state) noexcept;
+    bool skip_guarded(CParseContext& context, const std::string& text);
+    void scan_directive(const CParseContext& context, const std::string& cmd, size_t depth);
+    void scan_output(char c);
+    void scan_token();
+
     void include(std::istream& in, CParseContext& context);
     void define(std::istream& in, CParseContext& context);
     void pragma(std::istream& in, CParseContext& context);
@@ -2,6 +2,7 @@
 
 #include <iostream>
 #include <fstream>
+#include <sstream>
 #include <utility>
 #include <cctype>
 #include <parser.hpp>
@@ -55,8 +56,25 @@ void rychkov::Preprocessor::include(std::istream& in, CParseContext& context)
     log(context, "failed to open file");
     return;
   }
+  std::stringstream contents;
+  contents << file.rdbuf();
+  std::string text = contents.str();
+  if (skip_guarded(context, text))
+  {
+    return;
+  }
   CParseContext file_context = {context.out, context.err, filename, &context};
-  parse(file_context, file, false);
+  guard_scans_.push_back({&file_context, conditional_pairs_.size(), {{}, {}, line_state(), {}},
+        false, false, true});
+  parse(file_context, contents, false);
+  GuardScan scan = std::move(guard_scans_.back());
+  guard_scans_.pop_back();
+  if (scan.valid && scan.closed && (file_context.nerrors == 0) && (state_ == NO_STATE)
+      && (prev_state_ == NO_STATE) && buf_.empty() && (include_cache != nullptr))
+  {
+    scan.guard.exit = line_state();
+    include_cache->insert(std::move(text), std::move(scan.guard));
+  }
   context.nerrors += file_context.nerrors;
 }
 void rychkov::Preprocessor::define(std::istream& in, CParseContext& context)
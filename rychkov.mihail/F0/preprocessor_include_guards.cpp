@@ -0,0 +1,92 @@
+#include "preprocessor.hpp"
+
+#include <sstream>
+#include <cctype>
+
+rychkov::LineState rychkov::Preprocessor::line_state() const noexcept
+{
+  return {prev_, screened_, empty_line_};
+}
+void rychkov::Preprocessor::restore_line_state(const LineState& state) noexcept
+{
+  prev_ = state.prev;
+  screened_ = state.screened;
+  empty_line_ = state.empty_line;
+}
+bool rychkov::Preprocessor::skip_guarded(CParseContext& context, const std::string& text)
+{
+  IncludeGuard guard;
+  if ((include_cache == nullptr) || !include_cache->find(text, guard))
+  {
+    return false;
+  }
+  if ((macros.find(guard.macro) == macros.end()) || !(guard.entry == line_state()))
+  {
+    return false;
+  }
+  for (char c: guard.whitespaces)
+  {
+    flush(context, c);
+  }
+  restore_line_state(guard.exit);
+  return true;
+}
+void rychkov::Preprocessor::scan_directive(const CParseContext& context, const std::string& cmd, size_t depth)
+{
+  bool conditional = (cmd == "ifdef") || (cmd == "ifndef") || (cmd == "else") || (cmd == "endif");
+  size_t new_depth = conditional_pairs_.size();
+  for (GuardScan& scan: guard_scans_)
+  {
+    if (&context != scan.file)
+    {
+      if ((depth <= scan.depth) || (new_depth <= scan.depth))
+      {
+        scan.valid = false;
+      }
+    }
+    else if (!scan.opened)
+    {
+      std::istringstream in(buf_);
+      std::string directive, name;
+      in >> std::noskipws >> directive >> std::skipws >> name;
+      scan.opened = true;
+      scan.guard.macro = name;
+      scan.valid = scan.valid && (cmd == "ifndef") && (depth == scan.depth) && (new_depth == depth + 1);
+    }
+    else if (!scan.closed && (cmd == "endif") && (depth == scan.depth + 1) && (new_depth == scan.depth))
+    {
+      scan.closed = true;
+    }
+    else if (conditional || (depth == scan.depth))
+    {
+      scan.valid = false;
+    }
+  }
+}
+void rychkov::Preprocessor::scan_output(char c)
+{
+  for (GuardScan& scan: guard_scans_)
+  {
+    if (conditional_pairs_.size() == scan.depth)
+    {
+      if (std::isspace(c))
+      {
+        scan.guard.whitespaces += c;
+      }
+      else
+      {
+        scan.valid = false;
+      }
+    }
+  }
+}
+void rychkov::Preprocessor::scan_token()
+{
+  for (GuardScan& scan: guard_scans_)
+  {
+    if (conditional_pairs_.size() == scan.depth)
+    {
+      scan.valid = false;
+    }
+  }
+}
@@ -2,6 +2,55 @@
 
 #include <iostream>
 #include <utility>
+#include <cctype>
+#include <algorithm>
+
+namespace
+{
+  bool is_name_char(char c)
+  {
+    return std::isalnum(c) || (c == '_');
+  }
+  bool is_number_char(char c)
+  {
+    return std::isalnum(c) || (c == '_') || (c == '.') || (c == '\'');
+  }
+}
+
+std::string::size_type rychkov::Preprocessor::append_run(const std::string& line, std::string::size_type pos)
+{
+  if (screened_)
+  {
+    return 0;
+  }
+  std::string::size_type end = pos;
+  switch (state_)
+  {
+  case SINGLE_LINE_COMMENT:
+    end = std::min(line.find('\\', pos), line.length());
+    break;
+  case MULTI_LINE_COMMENT:
+    end = std::min(line.find_first_of("/\\", pos), line.length());
+    if (end != pos)
+    {
+      prev_ = line[end - 1];
+    }
+    break;
+  case NAME:
+    for (; (end < line.length()) && is_name_char(line[end]); end++)
+    {}
+    buf_.append(line, pos, end - pos);
+    break;
+  case NUMBER:
+    for (; (end < line.length()) && is_number_char(line[end]); end++)
+    {}
+    buf_.append(line, pos, end - pos);
+    break;
+  default:
+    break;
+  }
+  return end - pos;
+}
 
 void rychkov::Preprocessor::append(CParseContext& context, char c)
 {
@@ -45,6 +45,7 @@ int main(int argc, char * argv[])
   cmds["rename"] = std::bind(rename_proj_or_shape, std::ref(std::cin), std::ref(std::cout), std::ref(projects));
 
   cmds["render"] = std::bind(render, std::ref(std::cin), std::ref(std::cout), std::ref(projects));
+  cmds["render_seeded"] = std::bind(render_seeded, std::ref(std::cin), std::ref(std::cout), std::ref(projects));
 
   cmds["rectangle"] = std::bind(create_rectangle, std::ref(std::cin), std::ref(std::cout), std::ref(projects));
   cmds["complexquad"] = std::bind(create_complexquad, std::ref(std::cin), std::ref(std::cout), std::ref(projects));
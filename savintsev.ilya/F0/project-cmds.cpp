@@ -593,3 +593,24 @@ void savintsev::render(std::istream & in, std::ostream & out, Projects & projs)
 
   out << "Project \"" << proj_name << "\" rendered successfully to \"" << image_name << ".bmp\"\n";
 }
+
+void savintsev::render_seeded(std::istream & in, std::ostream & out, Projects & projs)
+{
+  std::string proj_name, image_name;
+  int width, height;
+  unsigned seed;
+  in >> proj_name >> image_name >> width >> height >> seed;
+
+  if (projs.find(proj_name) == projs.end())
+  {
+    out << "Project \"" << proj_name << "\" not found\n";
+    return;
+  }
+
+  auto & proj = projs.at(proj_name);
+
+  Renderer rend(seed);
+  rend.render_project(proj, image_name, width, height);
+
+  out << "Project \"" << proj_name << "\" rendered successfully to \"" << image_name << ".bmp\"\n";
+}
@@ -1,11 +1,16 @@
 #ifndef RENDERER_HPP
 #define RENDERER_HPP
 #include <random>
+#include <atomic>
+#include <thread>
+#include <system_error>
+#include <cmath>
 #include <algorithm>
 #include <functional>
 #include <boost/gil.hpp>
 #include <boost/gil/extension/io/bmp.hpp>
 #include <shape-utils.hpp>
+#include <dynamic-array.hpp>
 #include "project-body.hpp"
 
 namespace gil = boost::gil;
@@ -15,101 +20,209 @@ namespace savintsev
   class Renderer
   {
   public:
+    Renderer():
+      rng(std::random_device{}())
+    {}
+    explicit Renderer(unsigned seed):
+      rng(seed)
+    {}
+
     void render_project(const savintsev::Project & proj, const std::string & name, int w, int h)
     {
       gil::rgb8_image_t image(w, h);
       auto view = gil::view(image);
 
       gil::fill_pixels(view, gil::rgb8_pixel_t(255, 255, 255));
-      struct RenderWrapper
+      struct CollectWrapper
       {
-        RenderWrapper(Renderer * r, gil::rgb8_view_t & v):
+        CollectWrapper(Renderer * r, Array< Polygon > & p):
           renderer(r),
-          view(v)
+          polygons(p)
         {}
         void operator()(const savintsev::Layer & layer)
         {
-          renderer->render_shape(view, layer.second);
+          polygons.push_back(renderer->make_polygon(layer.second));
         }
         Renderer * renderer;
-        gil::rgb8_view_t & view;
+        Array< Polygon > & polygons;
       };
 
-      std::for_each(proj.begin(), proj.end(), RenderWrapper(this, view));
+      Array< Polygon > polygons;
+      std::for_each(proj.begin(), proj.end(), CollectWrapper(this, polygons));
+      render_tiles(view, polygons);
 
       gil::write_view(name + ".bmp", view, gil::bmp_tag{});
     }
   private:
-    private:
-    void render_shape(gil::rgb8_view_t & view, const savintsev::Shape * shape)
+    struct Polygon
+    {
+      savintsev::point_t points[4];
+      size_t count;
+      gil::rgb8_pixel_t color;
+    };
+
+    static constexpr int TILE_HEIGHT = 32;
+
+    std::mt19937 rng;
+
+    gil::rgb8_pixel_t next_color()
     {
-      std::mt19937 rng(std::random_device{}());
       std::uniform_int_distribution<int> dist(50, 240);
+      uint8_t r = static_cast< uint8_t >(dist(rng));
+      uint8_t g = static_cast< uint8_t >(dist(rng));
+      uint8_t b = static_cast< uint8_t >(dist(rng));
+      return gil::rgb8_pixel_t(r, g, b);
+    }
 
-      gil::rgb8_pixel_t color
-      (
-        static_cast< uint8_t >(dist(rng)),
-        static_cast< uint8_t >(dist(rng)),
-        static_cast< uint8_t >(dist(rng))
-      );
+    Polygon make_polygon(const savintsev::Shape * shape)
+    {
+      Polygon polygon;
+      polygon.color = next_color();
 
       savintsev::point_t points[4];
       size_t point_count = shape->get_all_points(points);
 
       if (point_count == 2)
       {
-        savintsev::point_t rect_points[4];
-        rect_points[0] = {points[0].x, points[0].y};
-        rect_points[1] = {points[1].x, points[0].y};
-        rect_points[2] = {points[1].x, points[1].y};
-        rect_points[3] = {points[0].x, points[1].y};
-        fill_shape(view, rect_points, 4, color);
+        polygon.points[0] = {points[0].x, points[0].y};
+        polygon.points[1] = {points[1].x, points[0].y};
+        polygon.points[2] = {points[1].x, points[1].y};
+        polygon.points[3] = {points[0].x, points[1].y};
+        polygon.count = 4;
       }
       else
       {
-        fill_shape(view, points, point_count, color);
+        std::copy(points, points + point_count, polygon.points);
+        polygon.count = point_count;
+      }
+      return polygon;
+    }
+
+    void render_tiles(gil::rgb8_view_t & view, const Array< Polygon > & polygons) const
+    {
+      int height = view.height();
+      int tile_count = (height + TILE_HEIGHT - 1) / TILE_HEIGHT;
+      std::atomic< int > next_tile(0);
+      auto worker = [&]()
+      {
+        for (int tile = next_tile++; tile < tile_count; tile = next_tile++)
+        {
+          int y_begin = tile * TILE_HEIGHT;
+          int y_end = std::min(y_begin + TILE_HEIGHT, height);
+          for (size_t i = 0; i < polygons.size(); ++i)
+          {
+            fill_shape(view, polygons[i], y_begin, y_end);
+          }
+        }
+      };
+
+      int thread_count = std::min(static_cast< int >(std::thread::hardware_concurrency()), tile_count);
+      Array< std::thread > threads(std::max(thread_count, 1));
+      for (int i = 1; i < thread_count; ++i)
+      {
+        try
+        {
+          threads.push_back(std::thread(worker));
+        }
+        catch (const std::system_error &)
+        {
+          break;
+        }
+      }
+      worker();
+      for (size_t i = 0; i < threads.size(); ++i)
+      {
+        threads[i].join();
       }
     }
-    void fill_shape(gil::rgb8_view_t & view, const savintsev::point_t * points, size_t count, gil::rgb8_pixel_t c)
+
+    void fill_shape(gil::rgb8_view_t & view, const Polygon & polygon, int y_begin, int y_end) const
     {
+      size_t count = polygon.count;
       if (count < 3)
       {
         return;
       }
+      const savintsev::point_t * points = polygon.points;
 
       int width = view.width();
       int height = view.height();
 
-      for (int y = 0; y < height; ++y)
+      double min_y = points[0].y;
+      double max_y = points[0].y;
+      for (size_t i = 1; i < count; ++i)
+      {
+        min_y = std::min(min_y, points[i].y);
+        max_y = std::max(max_y, points[i].y);
+      }
+      double first_row = std::floor(height / 2.0 + 0.5 - max_y) - 1;
+      double last_row = std::ceil(height / 2.0 + 0.5 - min_y) + 1;
+      if (first_row > y_begin)
       {
-        for (int x = 0; x < width; ++x)
+        y_begin = first_row < y_end ? static_cast< int >(first_row) : y_end;
+      }
+      if (last_row < y_end - 1)
+      {
+        y_end = last_row >= y_begin ? static_cast< int >(last_row) + 1 : y_begin;
+      }
+
+      for (int y = y_begin; y < y_end; ++y)
+      {
+        double fy = height / 2.0 - y;
+        double py = fy + 0.5;
+
+        double crossings[4];
+        size_t crossing_count = 0;
+        for (size_t i = 0, j = count - 1; i < count; j = i++)
         {
-          double fx = x - width / 2.0;
-          double fy = height / 2.0 - y;
+          double xi = points[i].x, yi = points[i].y;
+          double xj = points[j].x, yj = points[j].y;
+          if ((yi > py) != (yj > py))
+          {
+            crossings[crossing_count++] = (xj - xi) * (py - yi) / (yj - yi + 1e-15) + xi;
+          }
+        }
+        std::sort(crossings, crossings + crossing_count);
 
-          if (is_point_in_polygon(points, count, fx + 0.5, fy + 0.5))
+        for (size_t k = 0; k + 1 < crossing_count; k += 2)
+        {
+          int x_begin = first_column_at_or_after(crossings[k], width);
+          int x_end = first_column_at_or_after(crossings[k + 1], width);
+          for (int x = x_begin; x < x_end; ++x)
           {
-            view(x, y) = c;
+            view(x, y) = polygon.color;
           }
         }
       }
     }
 
-    bool is_point_in_polygon(const savintsev::point_t * points, size_t point_count, double x, double y)
+    static double column_center(int x, int width)
     {
-      bool inside = false;
-      for (size_t i = 0, j = point_count - 1; i < point_count; j = i++)
-      {
-        double xi = points[i].x, yi = points[i].y;
-        double xj = points[j].x, yj = points[j].y;
+      double fx = x - width / 2.0;
+      return fx + 0.5;
+    }
 
-        bool intersect = ((yi > y) != (yj > y)) && (x < (xj - xi) * (y - yi) / (yj - yi + 1e-15) + xi);
-        if (intersect)
-        {
-          inside = !inside;
-        }
+    static int first_column_at_or_after(double crossing, int width)
+    {
+      double estimate = std::ceil(crossing + width / 2.0 - 0.5);
+      int x = 0;
+      if (estimate >= width)
+      {
+        x = width;
+      }
+      else if (estimate > 0)
+      {
+        x = static_cast< int >(estimate);
+      }
+      while (x > 0 && column_center(x - 1, width) >= crossing)
+      {
+        --x;
+      }
+      while (x < width && column_center(x, width) < crossing)
+      {
+        ++x;
       }
-      return inside;
+      return x;
     }
   };
 }
@@ -126,6 +126,26 @@ BOOST_AUTO_TEST_CASE(insertRehash)
   BOOST_TEST(hashTable.size() == 3);
 }
 
+BOOST_AUTO_TEST_CASE(insertStringKeys)
+{
+  sharifullina::HashTable< std::string, int > hashTable;
+  for (int i = 0; i < 1000; ++i)
+  {
+    hashTable.insert(std::to_string(i), i);
+  }
+  for (int i = 0; i < 1000; i += 2)
+  {
+    hashTable.erase(std::to_string(i));
+  }
+  BOOST_TEST(hashTable.size() == 500);
+  for (int i = 1; i < 1000; i += 2)
+  {
+    BOOST_TEST(hashTable.at(std::to_string(i)) == i);
+  }
+  bool check = hashTable.find("0") == hashTable.end();
+  BOOST_TEST(check);
+}
+
 BOOST_AUTO_TEST_CASE(erase)
 {
   sharifullina::HashTable< int, std::string > hashTable;
@@ -1,6 +1,7 @@
 #ifndef HASH_TABLE_HPP
 #define HASH_TABLE_HPP
 
+#include <string>
 #include <boost/hash2/xxhash.hpp>
 #include "iterator.hpp"
 #include "hashNode.hpp"
@@ -19,6 +20,27 @@ namespace sharifullina
         return hasher.result();
       }
     };
+
+    template<>
+    struct XXHash< std::string >
+    {
+      size_t operator()(const std::string & key) const
+      {
+        boost::hash2::xxhash_64 hasher;
+        hasher.update(key.data(), key.size());
+        return hasher.result();
+      }
+    };
+
+    inline size_t ceilPowerOfTwo(size_t value) noexcept
+    {
+      size_t result = 1;
+      while (result < value)
+      {
+        result <<= 1;
+      }
+      return result;
+    }
   }
 
   template< class Key, class T, class HS1 = std::hash< Key >, class HS2 = detail::XXHash< Key >, class EQ = std::equal_to< Key > >
@@ -27,6 +49,7 @@ namespace sharifullina
     using iterator = HashConstIterator< Key, T, HS1, HS2, EQ >;
 
     HashTable();
+    HashTable(const HS1 & hash1, const HS2 & hash2, const EQ & equal = EQ());
     HashTable(const HashTable & rhs);
     HashTable(HashTable && rhs) noexcept;
     ~HashTable();
@@ -59,17 +82,28 @@ namespace sharifullina
     size_t capacity_;
     size_t size_;
     float maxLoadFactor_ = 0.7f;
+    HS1 hasher1_;
+    HS2 hasher2_;
+    EQ equal_;
 
-    std::pair< size_t, size_t > calculatePositions(const Key & key) const noexcept;
-    std::pair< size_t, bool > findPosition(const Key & key) const noexcept;
+    std::pair< size_t, size_t > calculateHashes(const Key & key) const noexcept;
+    std::pair< size_t, bool > findPosition(const Key & key, std::pair< size_t, size_t > hashes) const noexcept;
     void rehashIfNeeded();
   };
 
   template< class Key, class T, class HS1, class HS2, class EQ >
   HashTable< Key, T, HS1, HS2, EQ >::HashTable():
-    slots_(new HashNode< Key, T >[10]),
-    capacity_(10),
-    size_(0)
+    HashTable(HS1(), HS2())
+  {}
+
+  template< class Key, class T, class HS1, class HS2, class EQ >
+  HashTable< Key, T, HS1, HS2, EQ >::HashTable(const HS1 & hash1, const HS2 & hash2, const EQ & equal):
+    slots_(new HashNode< Key, T >[16]),
+    capacity_(16),
+    size_(0),
+    hasher1_(hash1),
+    hasher2_(hash2),
+    equal_(equal)
   {}
 
   template< class Key, class T, class HS1, class HS2, class EQ >
@@ -82,11 +116,14 @@ namespace sharifullina
   HashTable< Key, T, HS1, HS2, EQ >::HashTable(const HashTable & rhs):
     slots_(new HashNode< Key, T >[rhs.capacity_]),
     capacity_(rhs.capacity_),
-    size_(rhs.size_)
+    size_(rhs.size_),
+    hasher1_(rhs.hasher1_),
+    hasher2_(rhs.hasher2_),
+    equal_(rhs.equal_)
   {
     for (size_t i = 0; i < capacity_; ++i)
     {
-      if (rhs.slots_[i].occupied && !rhs.slots_[i].deleted)
+      if (rhs.slots_[i].occupied)
       {
         slots_[i] = rhs.slots_[i];
       }
@@ -97,7 +134,10 @@ namespace sharifullina
   HashTable< Key, T, HS1, HS2, EQ >::HashTable(HashTable && rhs) noexcept:
     slots_(rhs.slots_),
     capacity_(rhs.capacity_),
-    size_(rhs.size_)
+    size_(rhs.size_),
+    hasher1_(std::move(rhs.hasher1_)),
+    hasher2_(std::move(rhs.hasher2_)),
+    equal_(std::move(rhs.equal_))
   {
     rhs.slots_ = nullptr;
     rhs.capacity_ = 0;
@@ -124,6 +164,9 @@ namespace sharifullina
       slots_ = rhs.slots_;
       capacity_ = rhs.capacity_;
       size_ = rhs.size_;
+      hasher1_ = std::move(rhs.hasher1_);
+      hasher2_ = std::move(rhs.hasher2_);
+      equal_ = std::move(rhs.equal_);
       rhs.slots_ = nullptr;
       rhs.capacity_ = 0;
       rhs.size_ = 0;
@@ -143,6 +186,9 @@ namespace sharifullina
     std::swap(slots_, rhs.slots_);
     std::swap(capacity_, rhs.capacity_);
     std::swap(size_, rhs.size_);
+    std::swap(hasher1_, rhs.hasher1_);
+    std::swap(hasher2_, rhs.hasher2_);
+    std::swap(equal_, rhs.equal_);
   }
 
   template< class Key, class T, class HS1, class HS2, class EQ >
@@ -164,26 +210,24 @@ namespace sharifullina
   }
 
   template< class Key, class T, class HS1, class HS2, class EQ >
-  std::pair< size_t, size_t > HashTable< Key, T, HS1, HS2, EQ >::calculatePositions(const Key & key) const noexcept
+  std::pair< size_t, size_t > HashTable< Key, T, HS1, HS2, EQ >::calculateHashes(const Key & key) const noexcept
   {
-    size_t h1 = HS1{}(key) % capacity_;
-    size_t h2 = HS2{}(key) % (capacity_ - 1) + 1;
-    return {h1, h2};
+    return {hasher1_(key), hasher2_(key)};
   }
 
   template< class Key, class T, class HS1, class HS2, class EQ >
-  std::pair< size_t, bool > HashTable< Key, T, HS1, HS2, EQ >::findPosition(const Key & key) const noexcept
+  std::pair< size_t, bool > HashTable< Key, T, HS1, HS2, EQ >::findPosition(const Key & key, std::pair< size_t, size_t > hashes) const noexcept
   {
-    auto positions = calculatePositions(key);
-    size_t h1 = positions.first;
-    size_t h2 = positions.second;
+    size_t mask = capacity_ - 1;
+    size_t index = hashes.first & mask;
+    size_t step = (hashes.second & mask) | 1;
     size_t deletedSlot = capacity_;
 
     for (size_t i = 0; i < capacity_; ++i)
     {
-      size_t index = (h1 + i * h2) % capacity_;
+      const HashNode< Key, T > & slot = slots_[index];
 
-      if (!slots_[index].occupied)
+      if (!slot.occupied)
       {
         if (deletedSlot != capacity_)
         {
@@ -191,17 +235,22 @@ namespace sharifullina
         }
         return {index, true};
       }
-      else if (slots_[index].deleted && deletedSlot == capacity_)
+      else if (slot.deleted)
       {
-        deletedSlot = index;
+        if (deletedSlot == capacity_)
+        {
+          deletedSlot = index;
+        }
       }
-      else if (EQ{}(slots_[index].data.first, key))
+      else if (slot.hash1 == hashes.first && equal_(slot.data.first, key))
       {
         return {index, false};
       }
+
+      index = (index + step) & mask;
     }
 
-    return {capacity_, false};
+    return {deletedSlot, deletedSlot != capacity_};
   }
 
   template< class Key, class T, class HS1, class HS2, class EQ >
@@ -218,7 +267,8 @@ namespace sharifullina
   {
     rehashIfNeeded();
 
-    auto positionInfo = findPosition(key);
+    auto hashes = calculateHashes(key);
+    auto positionInfo = findPosition(key, hashes);
     size_t pos = positionInfo.first;
     bool isNew = positionInfo.second;
 
@@ -230,6 +280,8 @@ namespace sharifullina
     if (isNew)
     {
       slots_[pos].data = std::make_pair(key, value);
+      slots_[pos].hash1 = hashes.first;
+      slots_[pos].hash2 = hashes.second;
       slots_[pos].occupied = true;
       slots_[pos].deleted = false;
       ++size_;
@@ -248,7 +300,6 @@ namespace sharifullina
     }
 
     size_t index = pos.current_;
-    slots_[index].occupied = false;
     slots_[index].deleted = true;
     --size_;
 
@@ -271,7 +322,7 @@ namespace sharifullina
   template< class Key, class T, class HS1, class HS2, class EQ >
   HashConstIterator< Key, T, HS1, HS2, EQ > HashTable< Key, T, HS1, HS2, EQ >::find(const Key & key) const noexcept
   {
-    auto positionInfo = findPosition(key);
+    auto positionInfo = findPosition(key, calculateHashes(key));
     size_t pos = positionInfo.first;
     bool isNew = positionInfo.second;
 
@@ -314,31 +365,27 @@ namespace sharifullina
   template< class Key, class T, class HS1, class HS2, class EQ >
   void HashTable< Key, T, HS1, HS2, EQ >::rehash(size_t newCapacity)
   {
+    newCapacity = detail::ceilPowerOfTwo(newCapacity);
     if (newCapacity <= capacity_)
     {
       return;
     }
 
     HashNode< Key, T > * newSlots = new HashNode< Key, T >[newCapacity];
+    size_t mask = newCapacity - 1;
 
     for (size_t i = 0; i < capacity_; ++i)
     {
       if (slots_[i].occupied && !slots_[i].deleted)
       {
-        const Key & key = slots_[i].data.first;
-        auto positions = calculatePositions(key);
-        size_t h1 = positions.first;
-        size_t h2 = positions.second;
+        size_t index = slots_[i].hash1 & mask;
+        size_t step = (slots_[i].hash2 & mask) | 1;
 
-        for (size_t j = 0; j < newCapacity; ++j)
+        while (newSlots[index].occupied)
         {
-          size_t index = (h1 + j * h2) % newCapacity;
-          if (!newSlots[index].occupied)
-          {
-            newSlots[index] = slots_[i];
-            break;
-          }
+          index = (index + step) & mask;
         }
+        newSlots[index] = std::move(slots_[i]);
       }
     }
 